@@ -0,0 +1,484 @@
+/* ch2d_bench_main.cpp
+The main entry point of the 2D Convex Hull benchmark. Generates datasets in
+memory with a seeded random number generator and times the phases of the
+convex hull engines separately.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Added the lattice distribution and the hull check.
+    17/Oct/2026 - Added the libch2d index engine.
+    17/Oct/2026 - Added the dynamic hull updates.
+    17/Oct/2026 - Added the collinear index hull check.
+    17/Oct/2026 - Added the duplicate index hull check.
+    17/Oct/2026 - Added the pseudo-angle policy of the angle scan engine.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "ch_alg2d.hpp"
+#include "ch_dyn2d.hpp"
+#include "ch_lib2d.hpp"
+#include "ch_pred2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+// Distributions of the generated datasets.
+enum class Distribution { square, disk, circle, gauss, lattice };
+
+static const char* getDistributionName(Distribution distribution) noexcept {
+    switch(distribution) {
+    case Distribution::square: return "square";
+    case Distribution::disk: return "disk";
+    case Distribution::circle: return "circle";
+    case Distribution::gauss: return "gauss";
+    default: return "lattice";
+    }
+}
+
+// Generates nPoints points. The same seed always delivers the same dataset.
+static void generateData(DataContainer& dataStore, Distribution distribution,
+        size_t nPoints, uint64_t iSeed) {
+    const double pi {3.14159265358979323846};
+    mt19937_64 engine(iSeed);
+    uniform_real_distribution<double> uniform(-1.0, 1.0);
+    uniform_real_distribution<double> angle(0.0, 2.0 * pi);
+    normal_distribution<double> normal(0.0, 0.5);
+
+    // The lattice is a grid of points spaced one unit in the last place
+    // apart near (0.5, 0.5), with four points per node on average, plus two
+    // distant points on the diagonal. The grid is full of duplicates and of
+    // points that are nearly collinear with the distant points, which is
+    // where double precision orientation tests produce inconsistent results.
+    int64_t iSide = max(int64_t(2), int64_t(sqrt(double(nPoints) / 4.0)));
+    uniform_int_distribution<int64_t> node(0, iSide - 1);
+    const double ulp {ldexp(1.0, -53)};
+
+    dataStore.resize(nPoints);
+    for(auto& point : dataStore) {
+        switch(distribution) {
+        case Distribution::square:
+            point.x = uniform(engine);
+            point.y = uniform(engine);
+            break;
+        case Distribution::disk:
+            // Rejection sampling keeps the density uniform.
+            do {
+                point.x = uniform(engine);
+                point.y = uniform(engine);
+            } while(point.x * point.x + point.y * point.y > 1.0);
+            break;
+        case Distribution::circle: {
+            // Every point is a vertex of the hull.
+            double alpha = angle(engine);
+            point.x = cos(alpha);
+            point.y = sin(alpha);
+            break;
+        }
+        case Distribution::gauss:
+            point.x = normal(engine);
+            point.y = normal(engine);
+            break;
+        case Distribution::lattice: {
+            size_t inxPoint = size_t(&point - dataStore.data());
+            if(inxPoint < 2) {
+                point.x = point.y = 12.0 * double(inxPoint + 1);
+                break;
+            }
+            point.x = 0.5 + double(node(engine)) * ulp;
+            point.y = 0.5 + double(node(engine)) * ulp;
+            break;
+        }
+        }
+        point.alpha = 0.0;
+    }
+}
+
+// Accumulates the durations of a benchmarked phase.
+struct PhaseStats {
+    const char* name;
+    double totalSeconds {0.0};
+};
+
+static void printResult(const PhaseStats& phase, Distribution distribution,
+        size_t nPoints, size_t nIterations) {
+    double seconds = phase.totalSeconds / double(nIterations);
+    string benchName = string("BM_") + phase.name + '/' + getDistributionName(distribution)
+        + '/' + to_string(nPoints);
+    printf("%-56s %12.3f ms %10zu %14.3f M points/s\n", benchName.c_str(), seconds * 1e3,
+        nIterations, seconds > 0.0 ? double(nPoints) / seconds * 1e-6 : 0.0);
+}
+
+static double orientation(const DataPoint2D& o, const DataPoint2D& a, const DataPoint2D& b) noexcept {
+    return calcOrientation2D(o.x, o.y, a.x, a.y, b.x, b.y);
+}
+static bool isSamePoint(const DataPoint2D& p1, const DataPoint2D& p2) noexcept {
+    return p1.x == p2.x && p1.y == p2.y;
+}
+static bool isLessXY(const DataPoint2D& p1, const DataPoint2D& p2) noexcept {
+    return p1.x < p2.x || (p1.x == p2.x && p1.y < p2.y);
+}
+
+// Checks the hulls delivered by calcConvexHull2D_mc with exact orientation
+// tests. The hull that drops the collinear points must be a strictly convex
+// counter-clockwise loop with every point of the dataset inside or on its
+// boundary. The hull that keeps them must consist of exactly the distinct
+// points located on that boundary.
+static bool checkHulls(const DataContainer& dataStore, const DataContainer& dropHull,
+        const DataContainer& keepHull) {
+    size_t nDrop = dropHull.size() - 1;
+    if(dropHull.size() < 4 || !isSamePoint(dropHull.front(), dropHull.back()))
+        return false;
+    for(size_t inx = 0; inx < nDrop; inx++)
+        if(orientation(dropHull[(inx + nDrop - 1) % nDrop], dropHull[inx], dropHull[inx + 1]) <= 0.0)
+            return false;
+
+    DataContainer boundary;
+    for(const auto& point : dataStore) {
+        bool bOnBoundary {false};
+        for(size_t inx = 0; inx < nDrop; inx++) {
+            const DataPoint2D& v1 = dropHull[inx];
+            const DataPoint2D& v2 = dropHull[inx + 1];
+            double det = orientation(v1, v2, point);
+            if(det < 0.0)
+                return false;
+            if(det == 0.0 && point.x >= min(v1.x, v2.x) && point.x <= max(v1.x, v2.x)
+                    && point.y >= min(v1.y, v2.y) && point.y <= max(v1.y, v2.y))
+                bOnBoundary = true;
+        }
+        if(bOnBoundary)
+            boundary.push_back(point);
+    }
+    sort(boundary.begin(), boundary.end(), isLessXY);
+    boundary.erase(unique(boundary.begin(), boundary.end(), isSamePoint), boundary.end());
+
+    if(keepHull.size() < 2 || !isSamePoint(keepHull.front(), keepHull.back()))
+        return false;
+    DataContainer keepVertices(keepHull.begin(), keepHull.end() - 1);
+    sort(keepVertices.begin(), keepVertices.end(), isLessXY);
+    return keepVertices.size() == boundary.size()
+        && equal(keepVertices.begin(), keepVertices.end(), boundary.begin(), isSamePoint);
+}
+
+// Checks calcConvexHull2D_indices in the keep-collinear mode on a triangle
+// with nBase collinear points along its bottom edge. The upper chain stacks
+// the bottom edge a second time before it pops it, so the check runs in a
+// scratch arena of exactly getScratchSize2D bytes followed by a guard band
+// that must stay intact. The line loop must list the bottom edge from left
+// to right followed by the apex.
+static bool checkCollinearIndexHull(size_t nBase) {
+    vector<BasicDataPoint2D<double>> points(nBase + 1);
+    for(size_t inx = 0; inx < nBase; inx++) {
+        points[inx].x = double(inx);
+        points[inx].y = 0.0;
+    }
+    points[nBase].x = double(nBase / 2);
+    points[nBase].y = double(nBase / 2);
+
+    const size_t guardSize {256};
+    const unsigned char guardByte {0xA5};
+    size_t scratchSize = getScratchSize2D(points.size());
+    vector<unsigned char> scratch(scratchSize + guardSize, guardByte);
+    vector<size_t> hullIndices(points.size() + 1);
+    size_t nHull = calcConvexHull2D_indices(points.data(), points.size(), scratch.data(), scratchSize,
+        hullIndices.data(), hullIndices.size(), false, true);
+
+    bool bPassed = all_of(scratch.begin() + scratchSize, scratch.end(),
+        [guardByte](unsigned char byte) { return byte == guardByte; });
+    bPassed = bPassed && nHull == nBase + 2 && hullIndices[nBase] == nBase && hullIndices[nBase + 1] == 0;
+    for(size_t inx = 0; bPassed && inx < nBase; inx++)
+        bPassed = hullIndices[inx] == inx;
+    printf("    collinear index hull check %s, base points: %zu\n", bPassed ? "passed" : "FAILED", nBase);
+    return bPassed;
+}
+
+// Checks that calcConvexHull2D_indices reports duplicate points once, by the
+// lowest of their indices, in both modes: on coincident points, which
+// deliver a loop of two copies of one index, and on a square with every
+// corner listed twice.
+static bool checkDuplicateIndexHull() {
+    struct Case {
+        vector<BasicDataPoint2D<double>> points;
+        vector<size_t> expected;
+    };
+    const vector<Case> cases {
+        {{{0.5, 0.5}, {0.5, 0.5}}, {0, 0}},
+        {{{0.5, 0.5}, {0.5, 0.5}, {0.5, 0.5}}, {0, 0}},
+        {{{0.5, 0.5}, {0.5, 0.5}, {0.5, 0.5}, {0.5, 0.5}, {0.5, 0.5}}, {0, 0}},
+        {{{1, 1}, {0, 0}, {1, 0}, {0, 0}, {0, 1}, {1, 1}, {1, 0}, {0, 1}}, {1, 2, 0, 4, 1}}
+    };
+
+    bool bPassed {true};
+    for(const auto& testCase : cases)
+        for(bool bKeepCollinear : {false, true}) {
+            size_t nPoints = testCase.points.size();
+            vector<unsigned char> scratch(getScratchSize2D(nPoints));
+            vector<size_t> hullIndices(nPoints + 1);
+            size_t nHull = calcConvexHull2D_indices(testCase.points.data(), nPoints, scratch.data(),
+                scratch.size(), hullIndices.data(), hullIndices.size(), false, bKeepCollinear);
+            hullIndices.resize(min(nHull, hullIndices.size()));
+            bPassed = bPassed && hullIndices == testCase.expected;
+        }
+    printf("    duplicate index hull check %s\n", bPassed ? "passed" : "FAILED");
+    return bPassed;
+}
+
+// Times the updates of DynamicHull2D holding nPoints points. An update
+// erases the oldest point and inserts a new one from the same distribution,
+// so the size of the set stays the same. Every iteration performs nUpdates
+// updates. Then the hull is compared with the one calcConvexHull2D_mc
+// delivers for the same points. Returns false if they differ.
+static bool runDynamicBenchmark(const DataContainer& originalStore, Distribution distribution,
+        size_t nIterations, uint64_t iSeed, double rebuildSeconds) {
+    size_t nPoints = originalStore.size();
+    size_t nUpdates = min(nPoints, size_t(10000));
+    DataContainer newPoints;
+    generateData(newPoints, distribution, nUpdates * nIterations, iSeed + 1);
+
+    // The points in the order of arrival. The oldest one is erased first.
+    DataContainer window(originalStore);
+    DynamicHull2D dynamicHull;
+    for(const auto& point : window)
+        dynamicHull.insert(point);
+
+    using clock = chrono::high_resolution_clock;
+    double totalSeconds {0.0};
+    size_t inxOldest {0};
+    for(size_t inx = 0; inx < nIterations; inx++) {
+        auto start = clock::now();
+        for(size_t inxUpdate = 0; inxUpdate < nUpdates; inxUpdate++) {
+            DataPoint2D& point = window[inxOldest];
+            dynamicHull.erase(point);
+            point = newPoints[inx * nUpdates + inxUpdate];
+            dynamicHull.insert(point);
+            inxOldest = (inxOldest + 1) % nPoints;
+        }
+        auto finish = clock::now();
+        totalSeconds += chrono::duration<double>(finish - start).count();
+    }
+
+    double seconds = totalSeconds / double(nIterations * nUpdates);
+    string benchName = string("BM_DynamicHull2D_update/") + getDistributionName(distribution)
+        + '/' + to_string(nPoints);
+    printf("%-56s %12.3f us %10zu %14.3f K updates/s\n", benchName.c_str(), seconds * 1e6,
+        nIterations * nUpdates, seconds > 0.0 ? 1e-3 / seconds : 0.0);
+
+    DataContainer dynamicHull2D, convexHull2D;
+    dynamicHull.getHull(dynamicHull2D);
+    calcConvexHull2D_mc(convexHull2D, window);
+    bool bPassed = dynamicHull2D.size() == convexHull2D.size()
+        && equal(dynamicHull2D.begin(), dynamicHull2D.end(), convexHull2D.begin(), isSamePoint);
+    printf("    dynamic hull check %s, an update is %.0f times faster than a rebuild\n",
+        bPassed ? "passed" : "FAILED", seconds > 0.0 ? rebuildSeconds / seconds : 0.0);
+    return bPassed;
+}
+
+// Times calculateCentroid, prepareData and calcConvexHull2D of the angle
+// scan engine on fresh copies of the dataset, the latter two with both angle
+// policies, and the monotone chain engine for reference. The libch2d index engine doesn't modify the dataset, so it
+// works on the same copy all the time. The updates of the dynamic hull are
+// compared with rebuilding the hull with the monotone chain engine. Returns
+// false if the lattice check or the dynamic hull check fails.
+static bool runBenchmark(Distribution distribution, size_t nPoints, size_t nIterations,
+        uint64_t iSeed, bool bDynamic) {
+    DataContainer originalStore;
+    generateData(originalStore, distribution, nPoints, iSeed);
+
+    PhaseStats centroidStats {"calculateCentroid"};
+    PhaseStats prepareStats {"prepareData"};
+    PhaseStats hullStats {"calcConvexHull2D"};
+    PhaseStats pseudoPrepareStats {"prepareData<PseudoAnglePolicy>"};
+    PhaseStats pseudoHullStats {"calcConvexHull2D<PseudoAnglePolicy>"};
+    PhaseStats mcStats {"calcConvexHull2D_mc"};
+    PhaseStats indexStats {"calcConvexHull2D_indices"};
+    using clock = chrono::high_resolution_clock;
+
+    DataContainer dataStore;
+    DataContainer convexHull2D;
+    size_t iHullSize {0};
+
+    // The library takes plain x, y pairs and caller-owned buffers.
+    vector<BasicDataPoint2D<double>> libPoints(nPoints);
+    for(size_t inx = 0; inx < nPoints; inx++) {
+        libPoints[inx].x = originalStore[inx].x;
+        libPoints[inx].y = originalStore[inx].y;
+    }
+    vector<unsigned char> scratch(getScratchSize2D(nPoints));
+    vector<size_t> hullIndices(nPoints + 1);
+    for(size_t inx = 0; inx < nIterations; inx++) {
+        dataStore = originalStore;
+        DataPoint2D centroid;
+
+        auto start = clock::now();
+        calculateCentroid(dataStore, centroid);
+        auto finish = clock::now();
+        centroidStats.totalSeconds += chrono::duration<double>(finish - start).count();
+
+        start = clock::now();
+        prepareData(dataStore, centroid);
+        finish = clock::now();
+        prepareStats.totalSeconds += chrono::duration<double>(finish - start).count();
+
+        // calcConvexHull2D appends the vertices to the container.
+        convexHull2D.clear();
+        start = clock::now();
+        if(dataStore.size() <= 4)
+            convexHull2D = dataStore;
+        else
+            calcConvexHull2D(convexHull2D, dataStore, centroid);
+        finish = clock::now();
+        hullStats.totalSeconds += chrono::duration<double>(finish - start).count();
+        iHullSize = convexHull2D.size();
+
+        // The same phases with the pseudo-angles. The centroid doesn't
+        // depend on the angle policy.
+        dataStore = originalStore;
+        start = clock::now();
+        prepareData<PseudoAnglePolicy>(dataStore, centroid);
+        finish = clock::now();
+        pseudoPrepareStats.totalSeconds += chrono::duration<double>(finish - start).count();
+
+        convexHull2D.clear();
+        start = clock::now();
+        if(dataStore.size() <= 4)
+            convexHull2D = dataStore;
+        else
+            calcConvexHull2D<PseudoAnglePolicy>(convexHull2D, dataStore, centroid);
+        finish = clock::now();
+        pseudoHullStats.totalSeconds += chrono::duration<double>(finish - start).count();
+
+        dataStore = originalStore;
+        start = clock::now();
+        calcConvexHull2D_mc(convexHull2D, dataStore);
+        finish = clock::now();
+        mcStats.totalSeconds += chrono::duration<double>(finish - start).count();
+
+        start = clock::now();
+        calcConvexHull2D_indices(libPoints.data(), nPoints, scratch.data(), scratch.size(),
+            hullIndices.data(), hullIndices.size());
+        finish = clock::now();
+        indexStats.totalSeconds += chrono::duration<double>(finish - start).count();
+    }
+
+    for(const auto& phase : {centroidStats, prepareStats, pseudoPrepareStats, hullStats, pseudoHullStats,
+            mcStats, indexStats})
+        printResult(phase, distribution, nPoints, nIterations);
+    cout << "    hull size: " << iHullSize << '\n';
+
+    bool bDynamicPassed {true};
+    if(bDynamic)
+        bDynamicPassed = runDynamicBenchmark(originalStore, distribution, nIterations, iSeed,
+            mcStats.totalSeconds / double(nIterations));
+
+    // The lattice is the stress test of the orientation predicate.
+    if(distribution != Distribution::lattice)
+        return bDynamicPassed;
+    DataContainer keepHull;
+    dataStore = originalStore;
+    calcConvexHull2D_mc(convexHull2D, dataStore);
+    dataStore = originalStore;
+    calcConvexHull2D_mc(keepHull, dataStore, true);
+    bool bPassed = checkHulls(originalStore, convexHull2D, keepHull);
+    cout << "    lattice check " << (bPassed ? "passed" : "FAILED") << ", hull size: "
+        << convexHull2D.size() << ", with collinear points: " << keepHull.size() << '\n';
+    return bPassed && bDynamicPassed;
+}
+
+static void printUsage() noexcept {
+    cout << "2D convex hull benchmark" << '\n';
+    cout << "Copyright (c) 2019 David Krikheli" << '\n';
+    cout << "Usage: ch2d-bench [options]" << '\n';
+    cout << " -d   dist  - distribution: square, disk, circle, gauss or lattice. All of them by default;" << '\n';
+    cout << " -h         - print help info. Same as --help;" << '\n';
+    cout << " -n   count - the number of points. Runs 1000, 10000, 100000 and 1000000 by default;" << '\n';
+    cout << " -r   rep   - the number of iterations per benchmark. Defaults to 5;" << '\n';
+    cout << " -seed num  - the seed of the random number generator. Defaults to 1." << '\n';
+}
+
+int main (int argc, char* argv[]) {
+    vector<Distribution> distributions;
+    vector<size_t> sizes;
+    size_t nIterations {5};
+    uint64_t iSeed {1};
+
+    for(int inx = 1; inx < argc; inx++) {
+        string strArg(argv[inx]);
+        if(strArg == "-h" || strArg == "--help") {
+            printUsage();
+            return 0;
+        }
+        if(inx + 1 == argc || (strArg != "-d" && strArg != "-n" && strArg != "-r" && strArg != "-seed")) {
+            cerr << "ch2d-bench error: unexpected argument " << strArg << '\n';
+            printUsage();
+            return 1;
+        }
+        string strValue(argv[++inx]);
+        if(strArg == "-d") {
+            if(strValue == "square")
+                distributions.push_back(Distribution::square);
+            else if(strValue == "disk")
+                distributions.push_back(Distribution::disk);
+            else if(strValue == "circle")
+                distributions.push_back(Distribution::circle);
+            else if(strValue == "gauss")
+                distributions.push_back(Distribution::gauss);
+            else if(strValue == "lattice")
+                distributions.push_back(Distribution::lattice);
+            else {
+                cerr << "ch2d-bench error: unknown distribution " << strValue << '\n';
+                return 1;
+            }
+            continue;
+        }
+        size_t iValue = size_t(strtoull(strValue.c_str(), nullptr, 10));
+        if(iValue == 0) {
+            cerr << "ch2d-bench error: invalid value " << strValue << " of option " << strArg << '\n';
+            return 1;
+        }
+        if(strArg == "-n")
+            sizes.push_back(iValue);
+        else if(strArg == "-r")
+            nIterations = iValue;
+        else
+            iSeed = iValue;
+    }
+
+    bool bDefaultSizes = sizes.empty();
+    if(bDefaultSizes)
+        sizes = {1000, 10000, 100000, 1000000};
+    if(distributions.empty())
+        distributions = {Distribution::square, Distribution::disk, Distribution::circle, Distribution::gauss,
+            Distribution::lattice};
+
+    printf("%-56s %15s %10s %25s\n", "Benchmark", "Time", "Iterations", "Throughput");
+    bool bPassed {true};
+    for(size_t nBase : {size_t(11), size_t(1000)})
+        bPassed = checkCollinearIndexHull(nBase) && bPassed;
+    bPassed = checkDuplicateIndexHull() && bPassed;
+    for(auto distribution : distributions)
+        for(size_t nPoints : sizes) {
+            // The angle scan engine is quadratic when every point is on the
+            // hull, so skip the large circles unless asked for explicitly. The
+            // same applies to the large lattices, where most points are
+            // nearly collinear with the hull edges.
+            if(bDefaultSizes && distribution == Distribution::circle && nPoints > 10000)
+                continue;
+            if(bDefaultSizes && distribution == Distribution::lattice && nPoints > 100000)
+                continue;
+            // Populating the dynamic hull takes a while, so the large sizes
+            // are skipped in its case.
+            bool bDynamic = !bDefaultSizes || nPoints <= 100000;
+            bPassed = runBenchmark(distribution, nPoints, nIterations, iSeed, bDynamic) && bPassed;
+        }
+    return bPassed ? 0 : 2;
+}
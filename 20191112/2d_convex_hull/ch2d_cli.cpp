@@ -0,0 +1,295 @@
+/* ch2d_cli.cpp
+Defines the command line parser of the 2D Convex Hull application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Matched the statement style of the directory.
+*/
+
+#include <iostream>
+#include "ch2d_cli.hpp"
+#include "ch_io2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+CH2DCLIParser::CH2DCLIParser(int argc, char** argv)
+    : CLIParserBase(argc, argv), strInpFile_{ "" },
+    iAlgorithmId_{ 0 }, bCull_{ false }, bKeepCollinear_{ false }, strOutFile_{ "" },
+    bBinaryOutput_{ false }, iThreadCount_{ 1 }, iStreamChunkSize_{ 0 },
+    iCheckpointInterval_{ 0 }, iWindowSize_{ 0 }, iMemoryLimit_{ 0 },
+    bProfile_{ false }, bProfileText_{ true }, bGrouped_{ false }, strPrecision_{ "" },
+    iFixedPointScale_{ 10000 }, iOutputPrecision_{ CSVWriter2D::defaultPrecision }, bIndexOutput_{ false },
+    bVectorised_{ false }, bPseudoAngles_{ false },
+    iTaskRepeatCount_{ 1 }, bDryRun_{ false }, bHelp_{ false }
+{
+}
+
+void CH2DCLIParser::parse() {
+    for(_inxArg = 1; _inxArg < _argc; _inxArg++) {
+        string strOption = string(_argv[_inxArg]);
+
+        if(strOption[0] == '-') {
+            // Input file.
+            if(_strOption("i", strInpFile_))
+                continue;
+            // Output file.
+            if(_strOption("o", strOutFile_))
+                continue;
+            // The coordinate type.
+            if(_strOption("p", strPrecision_)) {
+                if(strPrecision_ != strDoublePrecision && strPrecision_ != strSinglePrecision
+                        && strPrecision_ != strFixedPoint)
+                    throw CLIParserException(string("Invalid coordinate type in CLI option ") + strOption + '.');
+                continue;
+            }
+            // Write the output file in the binary format.
+            if(_boolOption("b", bBinaryOutput_))
+                continue;
+
+            // Cull interior points before building the hull.
+            if(_boolOption("c", bCull_))
+                continue;
+            // Keep collinear points on the edges of the hull.
+            if(_boolOption("cl", bKeepCollinear_))
+                continue;
+            // Grouped input, i.e. the batch mode.
+            if(_boolOption("g", bGrouped_))
+                continue;
+            // Write the indices of the vertices instead of the coordinates.
+            if(_boolOption("ix", bIndexOutput_))
+                continue;
+            // Pseudo-angles instead of atan2.
+            if(_boolOption("pa", bPseudoAngles_))
+                continue;
+            // Vectorised data preparation.
+            if(_boolOption("v", bVectorised_))
+                continue;
+            // Print the phase profile in the text or the JSON format.
+            if(_threeStateOption("-profile", bProfile_, "text", "json", bProfileText_))
+                continue;
+            // Help.
+            if(_boolOption("h", bHelp_))
+                continue;
+            if(_boolOption("-help", bHelp_))
+                continue;
+
+            // The id of the convex hull engine.
+            if(_uintOption("a", iAlgorithmId_)) {
+                if(iAlgorithmId_ > iMonotoneChainAlgId)
+                    throw CLIParserException(string("Invalid algorithm id in CLI option ") + strOption + '.');
+                continue;
+            }
+            // The number of threads.
+            if(_uintOption("j", iThreadCount_))
+                continue;
+            if(_uintOption("-threads", iThreadCount_))
+                continue;
+            // The streaming mode chunk size.
+            if(_uintOption("s", iStreamChunkSize_))
+                continue;
+            // The number of points between streaming mode checkpoints.
+            if(_uintOption("cp", iCheckpointInterval_))
+                continue;
+            // The number of points in the sliding window.
+            if(_uintOption("w", iWindowSize_))
+                continue;
+            // The memory limit of the out-of-core mode in megabytes.
+            if(_uintOption("-memory-limit", iMemoryLimit_)) {
+                if(iMemoryLimit_ < minMemoryLimit)
+                    throw CLIParserException(string("The memory limit in CLI option ") + strOption
+                        + " must be at least " + to_string(minMemoryLimit) + " MB.");
+                continue;
+            }
+            // The scale of the fixed-point coordinates.
+            if(_uintOption("fs", iFixedPointScale_))
+                continue;
+            // The number of significant digits of the output values.
+            if(_uintOption("sd", iOutputPrecision_)) {
+                if(iOutputPrecision_ > size_t(CSVWriter2D::maxPrecision))
+                    throw CLIParserException(string("Invalid number of significant digits in CLI option ") + strOption + '.');
+                continue;
+            }
+            // The task repeat count in the dry-run mode.
+            if(_uintOption("t", iTaskRepeatCount_)) {
+                bDryRun_ = true;
+                continue;
+            }
+
+            throw CLIParserException(string("Unknown CLI option ") + strOption + '.');
+        }
+
+        // For backward compatibility accept the input file path as a
+        // positional argument.
+        if(strInpFile_.size() > 0)
+            throw CLIParserException(string("Redefinition of the input file path: ") + strOption + '.');
+        strInpFile_ = strOption;
+    }   // for
+
+    if(bBinaryOutput_ && strOutFile_.size() == 0)
+        throw CLIParserException("Option -b requires an output file specified with option -o.");
+
+    if(iStreamChunkSize_) {
+        if(bDryRun_ || iThreadCount_ > 1 || bCull_ || iAlgorithmId_)
+            throw CLIParserException("Option -s is incompatible with options -a, -c, -j and -t.");
+        if(bVectorised_ || bPseudoAngles_)
+            throw CLIParserException("Option -s is incompatible with options -pa and -v.");
+    }
+    else if(iCheckpointInterval_ || iWindowSize_)
+        throw CLIParserException("Options -cp and -w require the streaming mode (option -s).");
+
+    if(bGrouped_) {
+        if(bDryRun_ || iStreamChunkSize_ || bBinaryOutput_ || iAlgorithmId_ == iAngleScanAlgId)
+            throw CLIParserException("Option -g is incompatible with options -a 1, -b, -s and -t.");
+        if(bVectorised_ || bPseudoAngles_)
+            throw CLIParserException("Option -g is incompatible with options -pa and -v.");
+    }
+
+    // The out-of-core mode is built on top of the single threaded monotone
+    // chain engine.
+    if(iMemoryLimit_) {
+        if(iAlgorithmId_ == iAngleScanAlgId || bGrouped_ || bIndexOutput_ || iThreadCount_ > 1)
+            throw CLIParserException("Option --memory-limit is incompatible with options -a 1, -g, -ix and -j.");
+        if(iStreamChunkSize_ || bDryRun_ || strPrecision_.size() > 0 || bVectorised_ || bPseudoAngles_)
+            throw CLIParserException("Option --memory-limit is incompatible with options -p, -pa, -s, -t and -v.");
+    }
+
+    if(bProfile_ && (bGrouped_ || iStreamChunkSize_ || bDryRun_))
+        throw CLIParserException("Option --profile is incompatible with options -g, -s and -t.");
+
+    // Only the monotone chain engine can retain collinear points.
+    if(bKeepCollinear_ && (iAlgorithmId_ == iAngleScanAlgId || iStreamChunkSize_ || bGrouped_))
+        throw CLIParserException("Option -cl is incompatible with options -a 1, -g and -s.");
+
+    // The indices are delivered by the libch2d engine.
+    if(bIndexOutput_) {
+        if(iThreadCount_ > 1 || iAlgorithmId_ == iAngleScanAlgId || bBinaryOutput_)
+            throw CLIParserException("Option -ix is incompatible with options -a 1, -b and -j.");
+        if(iStreamChunkSize_ || bGrouped_ || strPrecision_.size() > 0)
+            throw CLIParserException("Option -ix is incompatible with options -g, -p and -s.");
+    }
+
+    // The compact coordinate types are only supported by the single threaded
+    // monotone chain engine.
+    if(getPrecisionStr() != strDoublePrecision) {
+        if(iThreadCount_ > 1 || iAlgorithmId_ == iAngleScanAlgId)
+            throw CLIParserException("Option -p " + strPrecision_ + " is incompatible with options -a 1 and -j.");
+        if(iStreamChunkSize_ || bGrouped_ || bVectorised_ || bPseudoAngles_)
+            throw CLIParserException("Option -p " + strPrecision_ + " is incompatible with options -g, -pa, -s and -v.");
+    }
+
+    if(bVectorised_ && getAlgorithmId() != iAngleScanAlgId)
+        throw CLIParserException("Option -v only applies to the angle scan engine.");
+    if(bPseudoAngles_ && getAlgorithmId() != iAngleScanAlgId)
+        throw CLIParserException("Option -pa only applies to the angle scan engine.");
+
+    // The multithreaded mode is built on top of the monotone chain engine.
+    if(iThreadCount_ > 1 && iAlgorithmId_ == iAngleScanAlgId)
+        throw CLIParserException("Incompatible options -a 1 and --threads.");
+}
+void CH2DCLIParser::printUsage() noexcept {
+    cout << "2D convex hull calculator" << '\n';
+    cout << "Copyright (c) 2019 David Krikheli" << '\n';
+    cout << "Usage: " << "ch2d [input file path] [options]" << '\n';
+    cout << " --memory-limit MB - out-of-core mode. Read the input file in blocks and keep the memory" << '\n';
+    cout << "               footprint within 'MB' megabytes (" << minMemoryLimit << " at least). Implies -a 2;" << '\n';
+    cout << " --profile format - print the duration, the hardware counters and the point counts of each" << '\n';
+    cout << "               phase of the calculation and the peak memory footprint to the standard error" << '\n';
+    cout << "               stream. The format is either text or json;" << '\n';
+    cout << " -a   id    - convex hull engine id:" << '\n';
+    cout << "               1 - angle scan (default);" << '\n';
+    cout << "               2 - Andrew's monotone chain;" << '\n';
+    cout << " -b         - write the output file in the binary format;" << '\n';
+    cout << " -c         - cull interior points (Akl-Toussaint) before building the hull;" << '\n';
+    cout << " -cl        - keep collinear points on the edges of the hull. Implies -a 2;" << '\n';
+    cout << " -cp  count - print the hull every 'count' points in the streaming mode;" << '\n';
+    cout << " -fs  scale - the scale of the fixed-point coordinates. Defaults to 10000;" << '\n';
+    cout << " -g         - batch mode. Calculate a hull per group of the key,x,y input lines;" << '\n';
+    cout << " -h         - print help info. Same as --help. Overrides all other options;" << '\n';
+    cout << " -i   path  - input file path. Same as the positional input file path;" << '\n';
+    cout << " -ix        - write the indices of the vertices in the input file instead of the coordinates. Implies -a 2;" << '\n';
+    cout << " -j   num   - the number of threads. Same as --threads. Implies -a 2;" << '\n';
+    cout << " -o   path  - write the convex hull to the output file;" << '\n';
+    cout << " -p   type  - coordinate type: double (default), float or fixed. Implies -a 2;" << '\n';
+    cout << " -pa        - measure pseudo-angles instead of calling atan2 in the angle scan engine;" << '\n';
+    cout << " -s   size  - streaming mode. Read the input in chunks of 'size' points;" << '\n';
+    cout << " -sd  num   - the number of significant digits of the output values (1 - 17). Defaults to 6;" << '\n';
+    cout << " -t   rep   - dry-run 'rep' times and print average duration;" << '\n';
+    cout << " -v         - vectorised data preparation for the angle scan engine;" << '\n';
+    cout << " -w   size  - sliding window mode. Calculate the hull of the last 'size' points of the stream. Requires -s." << '\n';
+}
+const string& CH2DCLIParser::getInpFilePathStr() const noexcept {
+    return strInpFile_;
+}
+size_t CH2DCLIParser::getAlgorithmId() const noexcept {
+    if(iAlgorithmId_)
+        return iAlgorithmId_;
+    if(getPrecisionStr() != strDoublePrecision || bKeepCollinear_ || bIndexOutput_ || iMemoryLimit_)
+        return iMonotoneChainAlgId;
+    return iThreadCount_ > 1 ? iMonotoneChainAlgId : iAngleScanAlgId;
+}
+bool CH2DCLIParser::cull() const noexcept {
+    return bCull_;
+}
+bool CH2DCLIParser::keepCollinear() const noexcept {
+    return bKeepCollinear_;
+}
+const string& CH2DCLIParser::getOutFilePathStr() const noexcept {
+    return strOutFile_;
+}
+bool CH2DCLIParser::binaryOutput() const noexcept {
+    return bBinaryOutput_;
+}
+size_t CH2DCLIParser::getThreadCount() const noexcept {
+    return iThreadCount_;
+}
+size_t CH2DCLIParser::getStreamChunkSize() const noexcept {
+    return iStreamChunkSize_;
+}
+size_t CH2DCLIParser::getCheckpointInterval() const noexcept {
+    return iCheckpointInterval_;
+}
+size_t CH2DCLIParser::getWindowSize() const noexcept {
+    return iWindowSize_;
+}
+size_t CH2DCLIParser::getMemoryLimit() const noexcept {
+    return iMemoryLimit_;
+}
+bool CH2DCLIParser::profile() const noexcept {
+    return bProfile_;
+}
+bool CH2DCLIParser::profileText() const noexcept {
+    return bProfileText_;
+}
+bool CH2DCLIParser::grouped() const noexcept {
+    return bGrouped_;
+}
+const string& CH2DCLIParser::getPrecisionStr() const noexcept {
+    return strPrecision_.size() > 0 ? strPrecision_ : strDoublePrecision;
+}
+size_t CH2DCLIParser::getFixedPointScale() const noexcept {
+    return iFixedPointScale_;
+}
+int CH2DCLIParser::getOutputPrecision() const noexcept {
+    return int(iOutputPrecision_);
+}
+bool CH2DCLIParser::indexOutput() const noexcept {
+    return bIndexOutput_;
+}
+bool CH2DCLIParser::vectorised() const noexcept {
+    return bVectorised_;
+}
+bool CH2DCLIParser::pseudoAngles() const noexcept {
+    return bPseudoAngles_;
+}
+size_t CH2DCLIParser::getTaskRepeatCount() const noexcept {
+    return iTaskRepeatCount_;
+}
+bool CH2DCLIParser::dryRun() const noexcept {
+    return bDryRun_;
+}
+bool CH2DCLIParser::help() const noexcept {
+    return bHelp_;
+}
@@ -0,0 +1,88 @@
+/* ch2d_cli.hpp
+Declares the command line parser of the 2D Convex Hull application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch2d_cli_hpp
+#define ch2d_cli_hpp
+
+#include "../perm_gen/cli_parser_base.hpp"
+
+namespace dk {
+
+    // Ids of the convex hull engines available via the -a CLI option.
+    const size_t iAngleScanAlgId {1};
+    const size_t iMonotoneChainAlgId {2};
+
+    // Names of the coordinate types available via the -p CLI option.
+    const std::string strDoublePrecision {"double"};
+    const std::string strSinglePrecision {"float"};
+    const std::string strFixedPoint {"fixed"};
+
+    // The smallest memory limit in megabytes accepted by the --memory-limit
+    // CLI option.
+    const size_t minMemoryLimit {16};
+
+    class CH2DCLIParser : public dk::CLIParserBase {
+    public:
+        CH2DCLIParser(int, char**);
+        void parse();
+        static void printUsage() noexcept;
+
+        const std::string& getInpFilePathStr() const noexcept;
+        size_t getAlgorithmId() const noexcept;
+        bool cull() const noexcept;
+        bool keepCollinear() const noexcept;
+        const std::string& getOutFilePathStr() const noexcept;
+        bool binaryOutput() const noexcept;
+        size_t getThreadCount() const noexcept;
+        size_t getStreamChunkSize() const noexcept;
+        size_t getCheckpointInterval() const noexcept;
+        size_t getWindowSize() const noexcept;
+        size_t getMemoryLimit() const noexcept;
+        bool profile() const noexcept;
+        bool profileText() const noexcept;
+        bool grouped() const noexcept;
+        const std::string& getPrecisionStr() const noexcept;
+        size_t getFixedPointScale() const noexcept;
+        int getOutputPrecision() const noexcept;
+        bool indexOutput() const noexcept;
+        bool vectorised() const noexcept;
+        bool pseudoAngles() const noexcept;
+        size_t getTaskRepeatCount() const noexcept;
+        bool dryRun() const noexcept;
+        bool help() const noexcept;
+
+    private:
+        std::string strInpFile_;
+        size_t iAlgorithmId_;
+        bool bCull_;
+        bool bKeepCollinear_;
+        std::string strOutFile_;
+        bool bBinaryOutput_;
+        size_t iThreadCount_;
+        size_t iStreamChunkSize_;
+        size_t iCheckpointInterval_;
+        size_t iWindowSize_;
+        size_t iMemoryLimit_;
+        bool bProfile_;
+        bool bProfileText_;
+        bool bGrouped_;
+        std::string strPrecision_;
+        size_t iFixedPointScale_;
+        size_t iOutputPrecision_;
+        bool bIndexOutput_;
+        bool bVectorised_;
+        bool bPseudoAngles_;
+        size_t iTaskRepeatCount_;
+        bool bDryRun_;
+        bool bHelp_;
+    };  // class CH2DCLIParser
+
+};  // namespace dk
+
+#endif // ch2d_cli_hpp
@@ -0,0 +1,119 @@
+/* ch2d_conv_main.cpp
+The main entry point of the point cloud conversion utility. Converts CSV
+input files of the 2D Convex Hull application to the binary point cloud
+format and vice versa.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Added the 3D point clouds.
+    17/Oct/2026 - Write the CSV values with enough digits to round-trip.
+*/
+
+#include <iostream>
+#include <string>
+#include "ch_io2d.hpp"
+#include "ch_io3d.hpp"
+
+using namespace std;
+using namespace dk;
+
+static void printUsage() noexcept {
+    cout << "2D point cloud converter" << '\n';
+    cout << "Copyright (c) 2019 David Krikheli" << '\n';
+    cout << "Usage: ch2d-conv [input file path] [output file path] [options]" << '\n';
+    cout << "The input file can be either a CSV file or a binary point cloud file." << '\n';
+    cout << "A CSV input file is converted to the binary format and vice versa." << '\n';
+    cout << " -3         - convert 3D point clouds with x, y and z values;" << '\n';
+    cout << " -f         - store values as floats rather than doubles in the binary output file." << '\n';
+}
+
+// Converts a 3D point cloud. Returns the exit code of the application.
+static int convert3D(const string& inpFilePath, const string& outFilePath, bool bSinglePrecision) {
+    MappedFile inpFile;
+    if(!inpFile.open(inpFilePath)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+    bool bBinaryInput = isBinaryPointCloud3D(inpFile.data(), inpFile.size());
+    inpFile.close();
+
+    DataContainer3D dataStore;
+    if(!readInpFile3D(inpFilePath, dataStore)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+
+    bool bWritten = bBinaryInput ?
+        writeCSVFile3D(outFilePath, dataStore) : writeBinFile3D(outFilePath, dataStore, bSinglePrecision);
+    if(!bWritten) {
+        cerr << "Unable to write file " << outFilePath;
+        return 2;
+    }
+
+    cout << "Converted " << dataStore.size() << " points to the "
+        << (bBinaryInput ? "CSV" : "binary") << " format." << '\n';
+    return 0;
+}
+
+int main (int argc, char* argv[]) {
+    string inpFilePath;
+    string outFilePath;
+    bool bSinglePrecision {false};
+    bool b3D {false};
+    for(int inx = 1; inx < argc; inx++) {
+        string strArg(argv[inx]);
+        if(strArg == "-f")
+            bSinglePrecision = true;
+        else if(strArg == "-3")
+            b3D = true;
+        else if(strArg == "-h" || strArg == "--help") {
+            printUsage();
+            return 0;
+        }
+        else if(inpFilePath.size() == 0)
+            inpFilePath = strArg;
+        else if(outFilePath.size() == 0)
+            outFilePath = strArg;
+        else {
+            cerr << "ch2d-conv error: unexpected argument " << strArg << '\n';
+            printUsage();
+            return 1;
+        }
+    }
+    if(outFilePath.size() == 0) {
+        printUsage();
+        return 0;
+    }
+    if(b3D)
+        return convert3D(inpFilePath, outFilePath, bSinglePrecision);
+
+    // Check the format of the input file.
+    MappedFile inpFile;
+    if(!inpFile.open(inpFilePath)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+    bool bBinaryInput = isBinaryPointCloud(inpFile.data(), inpFile.size());
+    inpFile.close();
+
+    DataContainer dataStore;
+    if(!readInpFile(inpFilePath, dataStore)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+
+    // The CSV values reproduce the binary ones exactly.
+    bool bWritten = bBinaryInput ?
+        writeCSVFile(outFilePath, dataStore, CSVWriter2D::maxPrecision) :
+        writeBinFile(outFilePath, dataStore, bSinglePrecision);
+    if(!bWritten) {
+        cerr << "Unable to write file " << outFilePath;
+        return 2;
+    }
+
+    cout << "Converted " << dataStore.size() << " points to the "
+        << (bBinaryInput ? "CSV" : "binary") << " format." << '\n';
+    return 0;
+}
@@ -6,60 +6,678 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     11/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added command line options and the monotone chain engine.
+    17/Oct/2026 - Added the interior point culling stage.
+    17/Oct/2026 - Added the multithreaded engine and the dry-run timing mode.
+    17/Oct/2026 - Moved the input file reader to the ch_io2d module.
+    17/Oct/2026 - Added the output file option.
+    17/Oct/2026 - Added the vectorised data preparation option.
+    17/Oct/2026 - Added the pseudo-angle option.
+    17/Oct/2026 - Added the streaming mode.
+    17/Oct/2026 - Added the batch mode.
+    17/Oct/2026 - Added the compact coordinate types.
+    17/Oct/2026 - Added the collinear point option.
+    17/Oct/2026 - Switched to the buffered CSV writer and added the index output.
+    17/Oct/2026 - Added the sliding window mode.
+    17/Oct/2026 - Added the out-of-core mode.
+    17/Oct/2026 - Added the phase profiler.
+    17/Oct/2026 - Corrected the memory budget of the out-of-core mode.
+    17/Oct/2026 - Report the culled points in the index output mode.
+    17/Oct/2026 - Read the dataset of the vectorised option straight into the
+                  structure-of-arrays container and honour the angle policy.
+    17/Oct/2026 - Accounted for the block hull in the out-of-core memory budget.
 */
 
 #include <iostream>
 #include <fstream>
+#include <chrono>
+#include <cstdint>
 #include "ch_alg2d.hpp"
+#include "ch_batch2d.hpp"
+#include "ch_inc2d.hpp"
+#include "ch_io2d.hpp"
+#include "ch_lib2d.hpp"
+#include "ch_prec2d.hpp"
+#include "ch_prof2d.hpp"
+#include "ch_soa2d.hpp"
+#include "ch_win2d.hpp"
+#include "ch2d_cli.hpp"
 
 using namespace std;
 using namespace dk;
 
-bool readInpFile(const string& inpFileName, DataContainer& container) noexcept {
-    ifstream inpFile (inpFileName);
-    if (inpFile.is_open()) {
-        string inpLine;
-        DataPoint2D point;
-        while ( getline (inpFile, inpLine) ){
-            point.parse(inpLine);
-            container.push_back(point);
-        }
-        inpFile.close();
-            return true;
+// Runs the angle scan engine with the specified angle policy.
+template <class AnglePolicy>
+static void calcHullAngleScan(const CH2DCLIParser& parser, DataContainer& dataStore,
+        DataContainer& convexHull2D, PhaseProfiler2D& profiler) {
+    DataPoint2D centroid;
+    profiler.startPhase("centroid");
+    calculateCentroid(dataStore, centroid);
+    profiler.startPhase("prepare_data");
+    prepareData<AnglePolicy>(dataStore, centroid);
+
+    profiler.startPhase("hull_scan");
+    if(dataStore.size() <= 4)
+        convexHull2D = dataStore;
+    else
+        calcConvexHull2D<AnglePolicy>(convexHull2D, dataStore, centroid);
+}
+
+// Runs the angle scan engine with the specified angle policy on a dataset
+// held in the structure-of-arrays container. Returns the number of points
+// culled.
+template <class AnglePolicy>
+static size_t calcHullVectorised(const CH2DCLIParser& parser, DataContainerSoA2D& soaStore,
+        DataContainer& convexHull2D, PhaseProfiler2D& profiler) {
+    size_t iNumCulled {0};
+    if(parser.cull()) {
+        profiler.startPhase("cull");
+        iNumCulled = cullInteriorPoints(soaStore);
     }
+
+    DataPoint2D centroid;
+    profiler.startPhase("centroid");
+    calculateCentroid(soaStore, centroid);
+    profiler.startPhase("prepare_data");
+    DataContainer dataStore;
+    prepareData<AnglePolicy>(soaStore, centroid, dataStore);
+
+    profiler.startPhase("hull_scan");
+    if(dataStore.size() <= 4)
+        convexHull2D = dataStore;
     else
-        return false;
+        calcConvexHull2D<AnglePolicy>(convexHull2D, dataStore, centroid);
+    return iNumCulled;
 }
 
-int main (int argc, char* argv[]) {
-    if(argc <= 1) {
-        cout << "2D convex hull calculator" << '\n';
-        cout << "Copyright (c) 2019 David Krikheli" << '\n';
-        cout << "Usage: ch2d [input file path]" << '\n';
+// Calculates the convex hull using the engine selected on the command line.
+// Returns the number of points culled.
+static size_t calcHull(const CH2DCLIParser& parser, DataContainer& dataStore,
+        DataContainer& convexHull2D, PhaseProfiler2D& profiler) {
+    if(parser.getThreadCount() > 1) {
+        profiler.startPhase("parallel_hull");
+        return calcConvexHull2D_par(convexHull2D, dataStore, parser.getThreadCount(), parser.cull(),
+            parser.keepCollinear());
+    }
+
+    size_t iNumCulled {0};
+    if(parser.cull()) {
+        profiler.startPhase("cull");
+        iNumCulled = cullInteriorPoints(dataStore);
+    }
+
+    if(parser.getAlgorithmId() == iMonotoneChainAlgId) {
+        profiler.startPhase("sort_and_scan");
+        calcConvexHull2D_mc(convexHull2D, dataStore, parser.keepCollinear());
+    }
+    else if(parser.pseudoAngles())
+        calcHullAngleScan<PseudoAnglePolicy>(parser, dataStore, convexHull2D, profiler);
+    else
+        calcHullAngleScan<Atan2AnglePolicy>(parser, dataStore, convexHull2D, profiler);
+    return iNumCulled;
+}
+
+// Repeats the calculation on fresh copies of the dataset and prints timing
+// stats instead of the convex hull. The calcHull callable takes the hull and
+// the dataset.
+template <class Container, class CalcHull>
+static void dryRun(const CH2DCLIParser& parser, const Container& dataStore, CalcHull calcHull) {
+    std::chrono::duration<double> totalElapsed(0.0);
+    for(size_t inx = 0; inx < parser.getTaskRepeatCount(); inx++) {
+        Container workStore = dataStore;
+        Container convexHull2D;
+        auto start = std::chrono::high_resolution_clock::now();
+        calcHull(convexHull2D, workStore);
+        auto finish = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double> elapsed = finish - start;
+        totalElapsed += elapsed;
+        cout << "Test run #" << inx + 1 << " calculated a hull of " << convexHull2D.size()
+            << " points in " << elapsed.count() << " seconds." << '\n';
+    }
+    cout << '\t' << "Average duration: " << totalElapsed.count() / parser.getTaskRepeatCount() << '\n';
+}
+
+static void printHull(const CH2DCLIParser& parser, const DataContainer& convexHull2D) {
+    CSVWriter2D writer(cout, parser.getOutputPrecision());
+    for(const auto& point : convexHull2D)
+        writer.write(point.x, point.y);
+}
+
+// Reads points from the input stream in chunks and feeds them into an
+// incremental hull. Prints the hull at the checkpoints, if requested, and
+// at the end of the stream.
+static void processStream(const CH2DCLIParser& parser, istream& inpStream) {
+    IncrementalHull2D incHull;
+    DataContainer chunk;
+    DataContainer convexHull2D;
+    size_t iChunkSize = parser.getStreamChunkSize();
+    size_t iCheckpointInterval = parser.getCheckpointInterval();
+    size_t iNextCheckpoint = iCheckpointInterval;
+
+    while(true) {
+        // Don't let a chunk span a checkpoint.
+        size_t iMaxPoints = iChunkSize;
+        if(iCheckpointInterval)
+            iMaxPoints = min(iMaxPoints, iNextCheckpoint - incHull.getPointCount());
+
+        chunk.clear();
+        size_t iNumRead = readCSVChunk(inpStream, chunk, iMaxPoints);
+        incHull.insert(chunk);
+        if(iNumRead < iMaxPoints)
+            break;
+
+        if(iCheckpointInterval && incHull.getPointCount() == iNextCheckpoint) {
+            incHull.getHull(convexHull2D);
+            cout << "Checkpoint at " << incHull.getPointCount() << " data points. ";
+            cout << "Closed line loop of the convex hull consisting of " << convexHull2D.size() << " points:" << '\n';
+            printHull(parser, convexHull2D);
+            iNextCheckpoint += iCheckpointInterval;
+        }
+    }
+
+    incHull.getHull(convexHull2D);
+    cout << "Original count of data points: " << incHull.getPointCount() << '\n';
+    cout << "Closed line loop of the convex hull consisting of " << convexHull2D.size() << " points:" << '\n';
+    printHull(parser, convexHull2D);
+}
+
+// Counts durations in buckets of about 6% width on a logarithmic scale, so
+// the percentiles of an unbounded stream of durations are available in
+// constant memory.
+class LatencyHistogram {
+public:
+    LatencyHistogram() : buckets_(iBucketCount, 0), iCount_{ 0 }, iMaxNanoseconds_{ 0 } {}
+
+    void add(uint64_t iNanoseconds) {
+        buckets_[getBucket(iNanoseconds)]++;
+        iCount_++;
+        iMaxNanoseconds_ = max(iMaxNanoseconds_, iNanoseconds);
+    }
+    // Returns the upper bound of the bucket the percentile falls into.
+    uint64_t getPercentile(double percentile) const {
+        uint64_t iRank = uint64_t(percentile / 100.0 * double(iCount_));
+        uint64_t iTotal {0};
+        for(size_t inx = 0; inx < buckets_.size(); inx++) {
+            iTotal += buckets_[inx];
+            if(iTotal > iRank)
+                return min(iMaxNanoseconds_, getUpperBound(inx));
+        }
+        return iMaxNanoseconds_;
+    }
+    uint64_t getMax() const noexcept {
+        return iMaxNanoseconds_;
+    }
+
+private:
+    // The durations below 32 ns have a bucket each. Every power of two
+    // above that is split into 16 buckets.
+    static const size_t iSubBucketCount {16};
+    static const size_t iBucketCount {64 * iSubBucketCount};
+
+    static size_t getBucket(uint64_t iNanoseconds) noexcept {
+        size_t iShift {0};
+        while((iNanoseconds >> iShift) >= 2 * iSubBucketCount)
+            iShift++;
+        if(iShift == 0)
+            return size_t(iNanoseconds);
+        return (iShift + 1) * iSubBucketCount + size_t(iNanoseconds >> iShift) - iSubBucketCount;
+    }
+    static uint64_t getUpperBound(size_t inxBucket) noexcept {
+        if(inxBucket < 2 * iSubBucketCount)
+            return inxBucket;
+        size_t iShift = inxBucket / iSubBucketCount - 1;
+        uint64_t iSubBucket = inxBucket % iSubBucketCount + iSubBucketCount;
+        return ((iSubBucket + 1) << iShift) - 1;
+    }
+
+    vector<uint64_t> buckets_;
+    uint64_t iCount_;
+    uint64_t iMaxNanoseconds_;
+};
+
+// Reads points from the input stream in chunks and pushes them one by one
+// into a sliding window hull, timing every push. Prints the hull of the
+// window at the checkpoints, if requested, and at the end of the stream
+// along with the percentiles of the update latency.
+static void processWindow(const CH2DCLIParser& parser, istream& inpStream) {
+    SlidingWindowHull2D windowHull(parser.getWindowSize());
+    LatencyHistogram latencies;
+    DataContainer chunk;
+    vector<BasicDataPoint2D<double>> convexHull2D;
+    size_t iChunkSize = parser.getStreamChunkSize();
+    size_t iCheckpointInterval = parser.getCheckpointInterval();
+    size_t iPointCount {0};
+    using clock = chrono::steady_clock;
+
+    auto printWindowHull = [&]() {
+        size_t nHullPoints = windowHull.getHull(convexHull2D.data(), convexHull2D.size());
+        if(nHullPoints > convexHull2D.size()) {
+            convexHull2D.resize(nHullPoints);
+            windowHull.getHull(convexHull2D.data(), convexHull2D.size());
+        }
+        cout << "Closed line loop of the convex hull of the last " << windowHull.size()
+            << " data points consisting of " << nHullPoints << " points:" << '\n';
+        CSVWriter2D writer(cout, parser.getOutputPrecision());
+        for(size_t inx = 0; inx < nHullPoints; inx++)
+            writer.write(convexHull2D[inx].x, convexHull2D[inx].y);
+    };
+
+    while(true) {
+        chunk.clear();
+        size_t iNumRead = readCSVChunk(inpStream, chunk, iChunkSize);
+        for(const auto& point : chunk) {
+            auto start = clock::now();
+            windowHull.push(point.x, point.y);
+            auto finish = clock::now();
+            latencies.add(uint64_t(chrono::duration_cast<chrono::nanoseconds>(finish - start).count()));
+
+            iPointCount++;
+            if(iCheckpointInterval && iPointCount % iCheckpointInterval == 0) {
+                cout << "Checkpoint at " << iPointCount << " data points. ";
+                printWindowHull();
+            }
+        }
+        if(iNumRead < iChunkSize)
+            break;
+    }
+
+    cout << "Original count of data points: " << iPointCount << '\n';
+    if(iPointCount > 0) {
+        cout << "Update latency, microseconds:";
+        for(double percentile : {50.0, 90.0, 99.0, 99.9})
+            cout << " p" << percentile << ' ' << double(latencies.getPercentile(percentile)) * 1e-3 << ',';
+        cout << " max " << double(latencies.getMax()) * 1e-3 << '\n';
+    }
+    printWindowHull();
+}
+
+// Prints the summary and writes the hull either to the output file or to the
+// standard output stream.
+static int outputHull(const CH2DCLIParser& parser, const DataContainer& convexHull2D,
+        size_t iNumPoints, size_t iNumCulled, PhaseProfiler2D& profiler) {
+    profiler.setPointCount(iNumPoints);
+    profiler.setCulledCount(iNumCulled);
+    profiler.setHullSize(convexHull2D.size());
+    profiler.startPhase("output");
+    cout << "Original count of data points: " << iNumPoints << '\n';
+    if(parser.cull())
+        cout << "Interior points culled: " << iNumCulled << '\n';
+    cout << "Closed line loop of the convex hull consisting of " << convexHull2D.size() << " points";
+
+    const string& outFilePath = parser.getOutFilePathStr();
+    if(outFilePath.size() > 0) {
+        cout << " written to " << outFilePath << '\n';
+        bool bWritten = parser.binaryOutput() ?
+            writeBinFile(outFilePath, convexHull2D) :
+            writeCSVFile(outFilePath, convexHull2D, parser.getOutputPrecision());
+        if(!bWritten) {
+            cerr << "Unable to write file " << outFilePath;
+            return 2;
+        }
         return 0;
     }
 
-    string inpFilePath {argv[1]};
-    DataContainer dataStore;
-    if(!readInpFile(inpFilePath, dataStore)) {
+    cout << ":" << '\n';
+    printHull(parser, convexHull2D);
+    return 0;
+}
+
+// Calculates the hull of an input file that may not fit in memory. The file
+// is read in blocks and the hull of every block is calculated with the
+// monotone chain engine. Only the vertices of the block hulls are retained
+// as candidates and the hull of the candidates is the hull of the file.
+//
+// A block of B bytes holds up to B/4 points because the shortest CSV line,
+// e.g. "0,0", takes 4 bytes with the line break. A chain of the monotone
+// chain engine holds up to one entry per point, or two in the keep-collinear
+// mode where the upper chain may stack the collinear points of the lower
+// chain once more. Each container below is reserved once for its worst
+// case, so with s = sizeof(DataPoint2D) and f chain entries per point the
+// memory limit L is split as follows:
+//  - the block reader holds two block buffers and the points of one block,
+//    and the hull of the block is built next to them. Together they take
+//    2B + (1 + f)*s*B/4 bytes, which is 3L/4;
+//  - the candidates are limited to C points and their hull is built in a
+//    separate container of f*C entries, which takes the remaining L/4.
+// If appending the hull of a block would take the candidates past C then
+// they are replaced with their own hull first.
+static int processOutOfCore(const CH2DCLIParser& parser, PhaseProfiler2D& profiler) {
+    size_t iMemoryLimit = parser.getMemoryLimit() << 20;
+    bool bCull = parser.cull();
+    bool bKeepCollinear = parser.keepCollinear();
+    const size_t minLineSize {4};
+    const size_t iChainFactor = bKeepCollinear ? 2 : 1;
+    size_t iBlockSize = iMemoryLimit / 4 * 3 / (2 + (1 + iChainFactor) * sizeof(DataPoint2D) / minLineSize);
+    size_t iCandidateLimit = iMemoryLimit / 4 / ((1 + iChainFactor) * sizeof(DataPoint2D));
+
+    size_t iNumPoints {0};
+    size_t iNumCulled {0};
+    DataContainer blockHull;
+    DataContainer candidates;
+    DataContainer mergedHull;
+    blockHull.reserve(iChainFactor * (iBlockSize / minLineSize + 2) + 1);
+    auto reserveCandidates = [&]() {
+        candidates.reserve(iCandidateLimit);
+        mergedHull.reserve(iChainFactor * iCandidateLimit + 1);
+    };
+    reserveCandidates();
+
+    auto sink = [&](DataContainer& blockStore) {
+        iNumPoints += blockStore.size();
+        if(bCull)
+            iNumCulled += cullInteriorPoints(blockStore);
+        calcConvexHull2D_mc(blockHull, blockStore, bKeepCollinear);
+        // Leave out the point that closes the line loop.
+        size_t nHullPoints = blockHull.size() - (blockHull.size() > 1 ? 1 : 0);
+        if(candidates.size() + nHullPoints > iCandidateLimit) {
+            calcConvexHull2D_mc(mergedHull, candidates, bKeepCollinear);
+            candidates.assign(mergedHull.begin(), mergedHull.end() - (mergedHull.size() > 1 ? 1 : 0));
+            // The hull itself may be too big for the limit, in which case
+            // there is no way around keeping it.
+            if(candidates.size() + nHullPoints > iCandidateLimit / 2) {
+                while(candidates.size() + nHullPoints > iCandidateLimit / 2)
+                    iCandidateLimit *= 2;
+                reserveCandidates();
+            }
+        }
+        candidates.insert(candidates.end(), blockHull.begin(), blockHull.begin() + nHullPoints);
+    };
+
+    const string& inpFilePath = parser.getInpFilePathStr();
+    profiler.startPhase("read_and_block_hulls");
+    if(!readInpFileBlocks(inpFilePath, iBlockSize, sink)) {
         cerr << "Unable to read file " << inpFilePath;
         return 1;
     }
 
-    DataPoint2D centroid;
-    calculateCentroid(dataStore, centroid);
-    prepareData(dataStore, centroid);
+    profiler.startPhase("merge");
+    calcConvexHull2D_mc(mergedHull, candidates, bKeepCollinear);
+    return outputHull(parser, mergedHull, iNumPoints, iNumCulled, profiler);
+}
+
+// Calculates the hull of points stored in a compact coordinate type with the
+// monotone chain engine. The hull is converted back to double precision for
+// the output.
+template <class T>
+static int processCompact(const CH2DCLIParser& parser, PhaseProfiler2D& profiler) {
+    const string& inpFilePath = parser.getInpFilePathStr();
+    double scale = double(parser.getFixedPointScale());
+    BasicDataContainer2D<T> dataStore;
+    size_t iNumRejected {0};
+    profiler.startPhase("read");
+    if(!readInpFile(inpFilePath, dataStore, scale, iNumRejected)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+    if(iNumRejected)
+        cerr << "Skipped " << iNumRejected << " data points out of the range of the "
+            << parser.getPrecisionStr() << " coordinate type." << '\n';
+    size_t iNumPoints = dataStore.size();
+
+    bool bCull = parser.cull();
+    bool bKeepCollinear = parser.keepCollinear();
+    auto calcHull = [bCull, bKeepCollinear, &profiler](BasicDataContainer2D<T>& convexHull2D,
+            BasicDataContainer2D<T>& workStore) {
+        size_t iNumCulled {0};
+        if(bCull) {
+            profiler.startPhase("cull");
+            iNumCulled = cullInteriorPoints(workStore);
+        }
+        profiler.startPhase("sort_and_scan");
+        calcConvexHull2D_mc(convexHull2D, workStore, bKeepCollinear);
+        return iNumCulled;
+    };
+
+    if(parser.dryRun()) {
+        dryRun(parser, dataStore, calcHull);
+        return 0;
+    }
+
+    BasicDataContainer2D<T> compactHull;
+    size_t iNumCulled = calcHull(compactHull, dataStore);
+
+    profiler.startPhase("convert");
+    DataContainer convexHull2D(compactHull.size());
+    for(size_t inx = 0; inx < compactHull.size(); inx++) {
+        convexHull2D[inx].x = CoordinateTraits<T>::toDouble(compactHull[inx].x, scale);
+        convexHull2D[inx].y = CoordinateTraits<T>::toDouble(compactHull[inx].y, scale);
+    }
+    return outputHull(parser, convexHull2D, iNumPoints, iNumCulled, profiler);
+}
+
+// Calculates the hull with the angle scan engine and the vectorised data
+// preparation. The dataset is read straight into the structure-of-arrays
+// container.
+static int processVectorised(const CH2DCLIParser& parser, PhaseProfiler2D& profiler) {
+    const string& inpFilePath = parser.getInpFilePathStr();
+    DataContainerSoA2D soaStore;
+    profiler.startPhase("read");
+    if(!readInpFile(inpFilePath, soaStore)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+    size_t iNumPoints = soaStore.size();
+
+    auto calcHull = [&parser, &profiler](DataContainer& convexHull2D, DataContainerSoA2D& workStore) {
+        if(parser.pseudoAngles())
+            return calcHullVectorised<PseudoAnglePolicy>(parser, workStore, convexHull2D, profiler);
+        return calcHullVectorised<Atan2AnglePolicy>(parser, workStore, convexHull2D, profiler);
+    };
+
+    if(parser.dryRun()) {
+        // The hull is only needed for its size.
+        auto calcHullSoA = [&calcHull](DataContainerSoA2D& convexHull2D, DataContainerSoA2D& workStore) {
+            DataContainer hull;
+            calcHull(hull, workStore);
+            convexHull2D.x.resize(hull.size());
+            convexHull2D.y.resize(hull.size());
+        };
+        dryRun(parser, soaStore, calcHullSoA);
+        return 0;
+    }
 
     DataContainer convexHull2D;
-    if(dataStore.size() <= 4)
-        convexHull2D = dataStore;
+    size_t iNumCulled = calcHull(convexHull2D, soaStore);
+    return outputHull(parser, convexHull2D, iNumPoints, iNumCulled, profiler);
+}
+
+// Calculates the hull with the libch2d engine, which doesn't reorder the
+// points, and writes the indices of its vertices in the input file.
+static int processIndices(const CH2DCLIParser& parser, PhaseProfiler2D& profiler) {
+    const string& inpFilePath = parser.getInpFilePathStr();
+    BasicDataContainer2D<double> dataStore;
+    size_t iNumRejected {0};
+    profiler.startPhase("read");
+    if(!readInpFile(inpFilePath, dataStore, 1.0, iNumRejected)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+    size_t iNumPoints = dataStore.size();
+
+    vector<unsigned char> scratch(getScratchSize2D(iNumPoints));
+    vector<size_t> hullIndices(iNumPoints + 1);
+    size_t iNumCulled {0};
+    auto calcIndices = [&]() {
+        return calcConvexHull2D_indices(dataStore.data(), iNumPoints, scratch.data(), scratch.size(),
+            hullIndices.data(), hullIndices.size(), parser.cull(), parser.keepCollinear(), &iNumCulled);
+    };
+
+    if(parser.dryRun()) {
+        auto calcHull = [&](BasicDataContainer2D<double>& convexHull2D, BasicDataContainer2D<double>&) {
+            convexHull2D.resize(calcIndices());
+        };
+        dryRun(parser, BasicDataContainer2D<double>(), calcHull);
+        return 0;
+    }
+
+    profiler.startPhase("hull");
+    size_t iNumIndices = calcIndices();
+    profiler.setPointCount(iNumPoints);
+    profiler.setCulledCount(iNumCulled);
+    profiler.setHullSize(iNumIndices);
+    profiler.startPhase("output");
+    cout << "Original count of data points: " << iNumPoints << '\n';
+    if(parser.cull())
+        cout << "Interior points culled: " << iNumCulled << '\n';
+    cout << "Closed line loop of the convex hull consisting of " << iNumIndices
+        << " points listed by their indices in the input file";
+
+    const string& outFilePath = parser.getOutFilePathStr();
+    ofstream outFile;
+    if(outFilePath.size() > 0) {
+        outFile.open(outFilePath);
+        if(!outFile) {
+            cerr << "Unable to write file " << outFilePath;
+            return 2;
+        }
+        cout << " written to " << outFilePath << '\n';
+    }
     else
-        calcConvexHull2D(convexHull2D, dataStore, centroid);
+        cout << ":" << '\n';
 
-    cout << "Original count of data points: " << dataStore.size()-1 << '\n';
-    cout << "Closed line loop of the convex hull consisting of " << convexHull2D.size() << " points:" << '\n';
-    for (const auto& point : convexHull2D)
-        cout << point.x << "," << point.y << '\n';
+    CSVWriter2D writer(outFilePath.size() > 0 ? outFile : cout);
+    for(size_t inx = 0; inx < iNumIndices; inx++)
+        writer.write(hullIndices[inx]);
+    if(!writer.flush()) {
+        cerr << "Unable to write file " << outFilePath;
+        return 2;
+    }
+    return 0;
+}
+
+// Calculates the hull of every group of the input file and writes the hulls
+// tagged by the group keys either to the output file or to the standard
+// output stream as soon as they are ready.
+static int processGroups(const CH2DCLIParser& parser) {
+    const string& inpFilePath = parser.getInpFilePathStr();
+    PointGroups2D pointGroups;
+    if(!readGroupedInpFile(inpFilePath, pointGroups)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+    size_t iNumPoints {0};
+    for(const auto& group : pointGroups.groups)
+        iNumPoints += group.size();
+
+    cout << "Original count of data points: " << iNumPoints << '\n';
+    cout << "Number of groups: " << pointGroups.groups.size() << '\n';
+    cout << "Closed line loops of the convex hulls tagged by group keys";
+
+    const string& outFilePath = parser.getOutFilePathStr();
+    ofstream outFile;
+    if(outFilePath.size() > 0) {
+        outFile.open(outFilePath);
+        if(!outFile) {
+            cerr << "Unable to write file " << outFilePath;
+            return 2;
+        }
+        cout << " written to " << outFilePath << '\n';
+    }
+    else
+        cout << ":" << '\n';
+    ostream& outStream = outFilePath.size() > 0 ? outFile : cout;
+
+    // The sink is called under a lock, so the threads can share the writer.
+    CSVWriter2D writer(outStream, parser.getOutputPrecision());
+    auto sink = [&](size_t inxGroup, const DataContainer& convexHull2D) {
+        const string& key = pointGroups.keys[inxGroup];
+        for(const auto& point : convexHull2D)
+            writer.write(key, point.x, point.y);
+    };
+    size_t iNumCulled = calcConvexHulls2D_batch(pointGroups, parser.getThreadCount(), parser.cull(), sink);
+    writer.flush();
 
+    if(parser.cull())
+        cout << "Interior points culled: " << iNumCulled << '\n';
+    if(outFilePath.size() > 0 && !outFile) {
+        cerr << "Unable to write file " << outFilePath;
+        return 2;
+    }
     return 0;
 }
+
+// Calculates the hull of the input file with the engine selected on the
+// command line.
+static int processFile(const CH2DCLIParser& parser, PhaseProfiler2D& profiler) {
+    if(parser.getMemoryLimit())
+        return processOutOfCore(parser, profiler);
+    if(parser.indexOutput())
+        return processIndices(parser, profiler);
+    if(parser.getPrecisionStr() == strSinglePrecision)
+        return processCompact<float>(parser, profiler);
+    if(parser.getPrecisionStr() == strFixedPoint)
+        return processCompact<int32_t>(parser, profiler);
+    if(parser.vectorised() && parser.getAlgorithmId() == iAngleScanAlgId)
+        return processVectorised(parser, profiler);
+
+    const string& inpFilePath = parser.getInpFilePathStr();
+    DataContainer dataStore;
+    profiler.startPhase("read");
+    if(!readInpFile(inpFilePath, dataStore, parser.getThreadCount())) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+    size_t iNumPoints = dataStore.size();
+
+    if(parser.dryRun()) {
+        dryRun(parser, dataStore, [&parser, &profiler](DataContainer& convexHull2D, DataContainer& workStore) {
+            calcHull(parser, workStore, convexHull2D, profiler);
+        });
+        return 0;
+    }
+
+    DataContainer convexHull2D;
+    size_t iNumCulled = calcHull(parser, dataStore, convexHull2D, profiler);
+    return outputHull(parser, convexHull2D, iNumPoints, iNumCulled, profiler);
+}
+
+int main (int argc, char* argv[]) {
+    CH2DCLIParser parser(argc, argv);
+    try {
+        parser.parse();
+    }
+    catch(const CLIParserException& e) {
+        cerr << string("ch2d error: ") + e.what() << '\n';
+        parser.printUsage();
+        return 1;
+    }
+
+    // Print usage instructions and exit if help has been requested
+    // or there is nothing to do.
+    if(parser.help() || (parser.getInpFilePathStr().size() == 0 && !parser.getStreamChunkSize())) {
+        parser.printUsage();
+        return 0;
+    }
+
+    if(parser.grouped())
+        return processGroups(parser);
+
+    // In the streaming mode the input arrives from the standard input stream
+    // unless an input file has been specified.
+    const string& inpFilePath = parser.getInpFilePathStr();
+    if(parser.getStreamChunkSize()) {
+        auto process = parser.getWindowSize() ? processWindow : processStream;
+        if(inpFilePath.size() == 0) {
+            process(parser, cin);
+            return 0;
+        }
+        ifstream inpFile(inpFilePath);
+        if(!inpFile) {
+            cerr << "Unable to read file " << inpFilePath;
+            return 1;
+        }
+        process(parser, inpFile);
+        return 0;
+    }
+
+    PhaseProfiler2D profiler(parser.profile());
+    int iResult = processFile(parser, profiler);
+    if(profiler.enabled()) {
+        profiler.endPhase();
+        if(parser.profileText())
+            profiler.writeText(cerr);
+        else
+            profiler.writeJSON(cerr);
+    }
+    return iResult;
+}
@@ -0,0 +1,93 @@
+/* ch3d_cli.cpp
+Defines the command line parser of the 3D Convex Hull application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Matched the statement style of the directory.
+*/
+
+#include <iostream>
+#include "ch3d_cli.hpp"
+
+using namespace std;
+using namespace dk;
+
+CH3DCLIParser::CH3DCLIParser(int argc, char** argv)
+    : CLIParserBase(argc, argv), strInpFile_{ "" }, bCull_{ false },
+    strOutFile_{ "" }, iThreadCount_{ 1 }, iTaskRepeatCount_{ 1 },
+    bDryRun_{ false }, bHelp_{ false }
+{
+}
+
+void CH3DCLIParser::parse() {
+    for(_inxArg = 1; _inxArg < _argc; _inxArg++) {
+        string strOption = string(_argv[_inxArg]);
+
+        if(strOption[0] == '-') {
+            // Input file.
+            if(_strOption("i", strInpFile_))
+                continue;
+            // Output file.
+            if(_strOption("o", strOutFile_))
+                continue;
+            // Cull interior points before building the hull.
+            if(_boolOption("c", bCull_))
+                continue;
+            // Help.
+            if(_boolOption("h", bHelp_))
+                continue;
+            if(_boolOption("-help", bHelp_))
+                continue;
+            // The number of threads.
+            if(_uintOption("j", iThreadCount_))
+                continue;
+            if(_uintOption("-threads", iThreadCount_))
+                continue;
+            // The task repeat count in the dry-run mode.
+            if(_uintOption("t", iTaskRepeatCount_)) {
+                bDryRun_ = true;
+                continue;
+            }
+
+            throw CLIParserException(string("Unknown CLI option ") + strOption + '.');
+        }
+
+        if(strInpFile_.size() > 0)
+            throw CLIParserException(string("Redefinition of the input file path: ") + strOption + '.');
+        strInpFile_ = strOption;
+    }   // for
+}
+void CH3DCLIParser::printUsage() noexcept {
+    cout << "3D convex hull calculator" << '\n';
+    cout << "Copyright (c) 2019 David Krikheli" << '\n';
+    cout << "Usage: " << "ch3d [input file path] [options]" << '\n';
+    cout << " -c         - cull interior points before building the hull;" << '\n';
+    cout << " -h         - print help info. Same as --help. Overrides all other options;" << '\n';
+    cout << " -i   path  - input file path. Same as the positional input file path;" << '\n';
+    cout << " -j   num   - the number of threads. Same as --threads;" << '\n';
+    cout << " -o   path  - write the convex hull to the output file in the Wavefront OBJ format;" << '\n';
+    cout << " -t   rep   - dry-run 'rep' times and print average duration." << '\n';
+}
+const string& CH3DCLIParser::getInpFilePathStr() const noexcept {
+    return strInpFile_;
+}
+bool CH3DCLIParser::cull() const noexcept {
+    return bCull_;
+}
+const string& CH3DCLIParser::getOutFilePathStr() const noexcept {
+    return strOutFile_;
+}
+size_t CH3DCLIParser::getThreadCount() const noexcept {
+    return iThreadCount_;
+}
+size_t CH3DCLIParser::getTaskRepeatCount() const noexcept {
+    return iTaskRepeatCount_;
+}
+bool CH3DCLIParser::dryRun() const noexcept {
+    return bDryRun_;
+}
+bool CH3DCLIParser::help() const noexcept {
+    return bHelp_;
+}
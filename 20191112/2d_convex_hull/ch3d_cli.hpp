@@ -0,0 +1,43 @@
+/* ch3d_cli.hpp
+Declares the command line parser of the 3D Convex Hull application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch3d_cli_hpp
+#define ch3d_cli_hpp
+
+#include "../perm_gen/cli_parser_base.hpp"
+
+namespace dk {
+
+    class CH3DCLIParser : public dk::CLIParserBase {
+    public:
+        CH3DCLIParser(int, char**);
+        void parse();
+        static void printUsage() noexcept;
+
+        const std::string& getInpFilePathStr() const noexcept;
+        bool cull() const noexcept;
+        const std::string& getOutFilePathStr() const noexcept;
+        size_t getThreadCount() const noexcept;
+        size_t getTaskRepeatCount() const noexcept;
+        bool dryRun() const noexcept;
+        bool help() const noexcept;
+
+    private:
+        std::string strInpFile_;
+        bool bCull_;
+        std::string strOutFile_;
+        size_t iThreadCount_;
+        size_t iTaskRepeatCount_;
+        bool bDryRun_;
+        bool bHelp_;
+    };  // class CH3DCLIParser
+
+};  // namespace dk
+
+#endif // ch3d_cli_hpp
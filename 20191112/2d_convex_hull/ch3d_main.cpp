@@ -0,0 +1,92 @@
+/* ch3d_main.cpp
+The main entry point of the 3D Convex Hull application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#include <iostream>
+#include <chrono>
+#include "ch_alg3d.hpp"
+#include "ch_io3d.hpp"
+#include "ch3d_cli.hpp"
+
+using namespace std;
+using namespace dk;
+
+// Repeats the calculation on fresh copies of the dataset and prints timing
+// stats instead of the convex hull.
+static void dryRun(const CH3DCLIParser& parser, const DataContainer3D& dataStore) {
+    std::chrono::duration<double> totalElapsed(0.0);
+    for(size_t inx = 0; inx < parser.getTaskRepeatCount(); inx++) {
+        DataContainer3D workStore = dataStore;
+        TriangleMesh3D convexHull3D;
+        auto start = std::chrono::high_resolution_clock::now();
+        calcConvexHull3D_par(convexHull3D, workStore, parser.getThreadCount(), parser.cull());
+        auto finish = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double> elapsed = finish - start;
+        totalElapsed += elapsed;
+        cout << "Test run #" << inx + 1 << " calculated a hull of " << convexHull3D.vertices.size()
+            << " vertices in " << elapsed.count() << " seconds." << '\n';
+    }
+    cout << '\t' << "Average duration: " << totalElapsed.count() / parser.getTaskRepeatCount() << '\n';
+}
+
+int main (int argc, char* argv[]) {
+    CH3DCLIParser parser(argc, argv);
+    try {
+        parser.parse();
+    }
+    catch(const CLIParserException& e) {
+        cerr << string("ch3d error: ") + e.what() << '\n';
+        parser.printUsage();
+        return 1;
+    }
+
+    if(parser.help() || parser.getInpFilePathStr().size() == 0) {
+        parser.printUsage();
+        return 0;
+    }
+
+    const string& inpFilePath = parser.getInpFilePathStr();
+    DataContainer3D dataStore;
+    if(!readInpFile3D(inpFilePath, dataStore)) {
+        cerr << "Unable to read file " << inpFilePath;
+        return 1;
+    }
+    size_t iNumPoints = dataStore.size();
+
+    if(parser.dryRun()) {
+        dryRun(parser, dataStore);
+        return 0;
+    }
+
+    TriangleMesh3D convexHull3D;
+    size_t iNumCulled = calcConvexHull3D_par(convexHull3D, dataStore, parser.getThreadCount(), parser.cull());
+
+    cout << "Original count of data points: " << iNumPoints << '\n';
+    if(parser.cull())
+        cout << "Interior points culled: " << iNumCulled << '\n';
+    if(convexHull3D.faces.empty()) {
+        cout << "The data points are coplanar, so the convex hull is degenerate." << '\n';
+        return 0;
+    }
+    cout << "Convex hull consisting of " << convexHull3D.vertices.size() << " vertices and "
+        << convexHull3D.faces.size() << " triangular faces";
+
+    const string& outFilePath = parser.getOutFilePathStr();
+    if(outFilePath.size() > 0) {
+        cout << " written to " << outFilePath << '\n';
+        if(!writeObjFile(outFilePath, convexHull3D)) {
+            cerr << "Unable to write file " << outFilePath;
+            return 2;
+        }
+        return 0;
+    }
+
+    cout << ":" << '\n';
+    writeObj(cout, convexHull3D);
+    return 0;
+}
@@ -5,15 +5,31 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     11/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the monotone chain engine.
+    17/Oct/2026 - Added the Akl-Toussaint interior point culling stage.
+    17/Oct/2026 - Added the multithreaded engine.
+    17/Oct/2026 - Made the angle scan engine a template on the angle policy.
+    17/Oct/2026 - Sort compact keys in prepareData with a parallel radix sort.
+    17/Oct/2026 - Moved the culling and monotone chain building blocks to
+                  templates shared with the compact point types.
+    17/Oct/2026 - Switched the monotone chain engine to the robust orientation
+                  predicate and added the collinear point option.
+    17/Oct/2026 - Exposed the angle sort.
+    17/Oct/2026 - Added the angle sort of separate alpha arrays.
 */
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
 #include "ch_alg2d.hpp"
+#include "ch_prec2d.hpp"
 
 using namespace std;
 using namespace dk;
 
-// This needs to be anything greater than 2*Pi.
+// This needs to be anything greater than 2*Pi (and greater than 4, which
+// is the upper boundary of the pseudo-angle domain).
 const double impossiblyLargeAngle = 7.0;
 
 static DataPoint2D getTipOfLongestVector(const DataContainer& container,
@@ -30,12 +46,139 @@ static DataPoint2D getTipOfLongestVector(const DataContainer& container,
     }
     return tip;
 }
-static bool compFunc4Sort(const DataPoint2D& p1, const DataPoint2D& p2) {
-    if(p1.alpha < p2.alpha)
-        return true;
-    return false;
+
+// A compact sort key of a data point. The key holds the bits of the angle
+// transformed so that comparing keys as unsigned integers delivers the same
+// order as comparing the angles as doubles. The index refers to the position
+// of the point in the dataset.
+struct AngleKey {
+    uint64_t key;
+    uint64_t index;
+};
+static inline uint64_t getSortableBits(double value) noexcept {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    // Flip all bits of negative values and only the sign bit of the rest.
+    const uint64_t signBit {uint64_t(1) << 63};
+    return (bits & signBit) ? ~bits : bits | signBit;
+}
+static bool compFunc4Sort(const AngleKey& k1, const AngleKey& k2) {
+    if(k1.key != k2.key)
+        return k1.key < k2.key;
+    return k1.index < k2.index;
+}
+
+// Sorts the keys with a least significant digit first radix sort. The sort is
+// stable, so it delivers the same order as compFunc4Sort does. Every pass
+// splits the keys into one chunk per thread: each thread builds a histogram
+// of its chunk, the histograms are turned into the output offsets of every
+// chunk and digit, then each thread scatters its chunk to those offsets.
+// Passes on digits that are the same in all keys are skipped. This is common
+// for the high order digits because the angles lie in a narrow range.
+static void radixSort(vector<AngleKey>& keys, size_t nThreads) {
+    const unsigned digitBits {11};
+    const size_t nBuckets {size_t(1) << digitBits};
+    const size_t nKeys = keys.size();
+    vector<AngleKey> buffer(nKeys);
+    vector<size_t> offsets(nThreads * nBuckets);
+
+    auto runOnThreads = [nThreads](auto&& func) {
+        vector<thread> threads;
+        threads.reserve(nThreads - 1);
+        for(size_t inxThread = 1; inxThread < nThreads; inxThread++)
+            threads.emplace_back(func, inxThread);
+        func(0);
+        for(auto& thr : threads)
+            thr.join();
+    };
+
+    for(unsigned shift = 0; shift < 64; shift += digitBits) {
+        // Count the digits of each chunk.
+        runOnThreads([&](size_t inxThread) {
+            size_t* pCounts = &offsets[inxThread * nBuckets];
+            fill(pCounts, pCounts + nBuckets, size_t(0));
+            size_t inxLast = (inxThread + 1) * nKeys / nThreads;
+            for(size_t inx = inxThread * nKeys / nThreads; inx < inxLast; inx++)
+                pCounts[(keys[inx].key >> shift) & (nBuckets - 1)]++;
+        });
+
+        // Turn the counts into offsets, digit by digit and chunk by chunk.
+        size_t iOffset {0};
+        bool bTrivialPass {false};
+        for(size_t inxBucket = 0; inxBucket < nBuckets; inxBucket++) {
+            size_t iBucketSize {0};
+            for(size_t inxThread = 0; inxThread < nThreads; inxThread++) {
+                size_t& count = offsets[inxThread * nBuckets + inxBucket];
+                size_t iCount = count;
+                count = iOffset;
+                iOffset += iCount;
+                iBucketSize += iCount;
+            }
+            if(iBucketSize == nKeys)
+                bTrivialPass = true;
+        }
+        if(bTrivialPass)
+            continue;
+
+        runOnThreads([&](size_t inxThread) {
+            size_t* pOffsets = &offsets[inxThread * nBuckets];
+            size_t inxLast = (inxThread + 1) * nKeys / nThreads;
+            for(size_t inx = inxThread * nKeys / nThreads; inx < inxLast; inx++)
+                buffer[pOffsets[(keys[inx].key >> shift) & (nBuckets - 1)]++] = keys[inx];
+        });
+        keys.swap(buffer);
+    }
+}
+
+// Sorts the keys of the angle sort. Large datasets are radix sorted on
+// multiple threads.
+static void sortAngleKeys(vector<AngleKey>& keys) {
+    const size_t nPoints = keys.size();
+
+    // Below the threshold the overheads of the radix sort passes and of the
+    // threads don't pay off.
+    const size_t radixSortThreshold {size_t(1) << 16};
+    const size_t minChunkSize {size_t(1) << 16};
+    if(nPoints < radixSortThreshold)
+        sort(keys.begin(), keys.end(), compFunc4Sort);
+    else {
+        size_t nThreads = max(size_t(1), min(size_t(thread::hardware_concurrency()), nPoints / minChunkSize));
+        radixSort(keys, nThreads);
+    }
+}
+
+// Sorts the dataset by angle. Rather than moving whole data points around the
+// function sorts compact keys and then permutes the points once.
+void dk::sortByAngle(DataContainer& dataStore) {
+    const size_t nPoints = dataStore.size();
+    vector<AngleKey> keys(nPoints);
+    for(size_t inx = 0; inx < nPoints; inx++)
+        keys[inx] = AngleKey{getSortableBits(dataStore[inx].alpha), inx};
+    sortAngleKeys(keys);
+
+    DataContainer sortedStore;
+    sortedStore.reserve(nPoints + 1);
+    for(const auto& key : keys)
+        sortedStore.push_back(dataStore[key.index]);
+    dataStore.swap(sortedStore);
+}
+void dk::sortByAngle(const double* alpha, size_t nPoints, vector<size_t>& order) {
+    vector<AngleKey> keys(nPoints);
+    for(size_t inx = 0; inx < nPoints; inx++)
+        keys[inx] = AngleKey{getSortableBits(alpha[inx]), inx};
+    sortAngleKeys(keys);
+
+    order.resize(nPoints);
+    for(size_t inx = 0; inx < nPoints; inx++)
+        order[inx] = size_t(keys[inx].index);
 }
 // Public interface functions.
+size_t dk::cullInteriorPoints(DataContainer& dataStore) noexcept {
+    auto it = cullRange2D(dataStore.begin(), dataStore.end());
+    size_t nCulled = size_t(dataStore.end() - it);
+    dataStore.erase(it, dataStore.end());
+    return nCulled;
+}
 void dk::calculateCentroid(const DataContainer& dataStore,
         DataPoint2D& centroid, const size_t subSampleSize) noexcept {
     centroid.x = 0.0;
@@ -49,14 +192,16 @@ void dk::calculateCentroid(const DataContainer& dataStore,
         centroid += dataStore[inx++];
     centroid /= inx;
 }
+template <class AnglePolicy>
 void dk::prepareData(DataContainer& dataStore, DataPoint2D& centroid) noexcept {
     // For each vector calculate the angle between that vector and the longest
     // vector in the dataset.
     DataPoint2D tipOfLongestVector = getTipOfLongestVector(dataStore, centroid);
+    DataPoint2D longestVector = tipOfLongestVector - centroid;
     for(auto& point: dataStore)
-        point.calcAlpha(tipOfLongestVector, centroid);
+        point.alpha = AnglePolicy::calcAngle(point - centroid, longestVector);
 
-    sort(dataStore.begin(), dataStore.end(), compFunc4Sort);
+    sortByAngle(dataStore);
 
     // Put a copy of the first point at the end of the sequence
     // to make sure the algorithm delivers a closed line loop.
@@ -96,6 +241,7 @@ void dk::prepareData(DataContainer& dataStore, DataPoint2D& centroid) noexcept {
             been reached. The last suitable candidate identified needs to be
             saved. Save it at the beginning of the next pass.
 */
+template <class AnglePolicy>
 void dk::calcConvexHull2D(DataContainer& convexHull2D,
         const DataContainer& dataStore, const DataPoint2D& centroid) noexcept {
     // Remember - the last point is the same as first point because we are
@@ -130,7 +276,7 @@ void dk::calcConvexHull2D(DataContainer& convexHull2D,
         {
             // Evaluate the delta between this vector and last saved vector.
             DataPoint2D deltaVector = *it - centroid - lastGoodVector;
-            double angle = DataPoint2D::calcAngle(deltaVector, lastGoodVector);
+            double angle = AnglePolicy::calcAngle(deltaVector, lastGoodVector);
             if(angle < minAngle) {
                 minAngle = angle;
                 candidatePointIt = it;
@@ -142,3 +288,93 @@ void dk::calcConvexHull2D(DataContainer& convexHull2D,
         offset = 0;
     }
 }
+
+// Explicit instantiations of the angle scan engine.
+template void dk::prepareData<Atan2AnglePolicy>(DataContainer&, DataPoint2D&) noexcept;
+template void dk::prepareData<PseudoAnglePolicy>(DataContainer&, DataPoint2D&) noexcept;
+template void dk::calcConvexHull2D<Atan2AnglePolicy>(DataContainer&, const DataContainer&, const DataPoint2D&) noexcept;
+template void dk::calcConvexHull2D<PseudoAnglePolicy>(DataContainer&, const DataContainer&, const DataPoint2D&) noexcept;
+
+/*  void dk::calcConvexHull2D_mc(...)
+
+    Andrew's monotone chain algorithm. After sorting the points by x (then by
+    y) the leftmost point is guaranteed to be on the hull, and so is the
+    rightmost point.
+
+    The steps are:
+        1.  Walk the sorted points from left to right building the lower
+            chain. Before appending a point drop the last point(s) of the
+            chain for as long as they fail to make a counter-clockwise turn
+            towards the new point;
+        2.  Walk the sorted points from right to left building the upper
+            chain in the same manner. The upper chain is appended to the
+            lower one and is not allowed to erode it;
+        3.  The upper chain finishes at the leftmost point, which closes the
+            line loop.
+
+    The orientation tests are evaluated with the robust predicate (see
+    ch_pred2d.hpp), so nearly collinear points are classified consistently.
+*/
+void dk::calcConvexHull2D_mc(DataContainer& convexHull2D,
+        DataContainer& dataStore, bool bKeepCollinear) noexcept {
+    buildHull2D_mc(convexHull2D, dataStore.begin(), dataStore.end(), bKeepCollinear);
+}
+
+/*  size_t dk::calcConvexHull2D_par(...)
+
+    Splits the dataset into one contiguous chunk per thread. Each thread
+    optionally culls the interior points of its chunk and then builds a hull
+    of the chunk with the monotone chain algorithm. Every vertex of the global
+    hull is a vertex of the hull of the chunk it belongs to, so the final hull
+    is calculated from the union of the partial hulls, which is typically
+    tiny compared with the input.
+*/
+size_t dk::calcConvexHull2D_par(DataContainer& convexHull2D,
+        DataContainer& dataStore, size_t nThreads, bool bCull, bool bKeepCollinear) {
+    size_t nPoints = dataStore.size();
+
+    // Don't bother spawning threads for chunks that are too small to benefit.
+    const size_t minChunkSize {4096};
+    nThreads = min(nThreads, nPoints / minChunkSize);
+    if(nThreads < 2) {
+        size_t nCulled {0};
+        if(bCull)
+            nCulled = cullInteriorPoints(dataStore);
+        calcConvexHull2D_mc(convexHull2D, dataStore, bKeepCollinear);
+        return nCulled;
+    }
+
+    vector<DataContainer> partialHulls(nThreads);
+    vector<size_t> culledCounts(nThreads, 0);
+    auto processChunk = [&](size_t inxChunk) {
+        auto first = dataStore.begin() + inxChunk * nPoints / nThreads;
+        auto last = dataStore.begin() + (inxChunk + 1) * nPoints / nThreads;
+        if(bCull) {
+            auto it = cullRange2D(first, last);
+            culledCounts[inxChunk] = size_t(last - it);
+            last = it;
+        }
+        buildHull2D_mc(partialHulls[inxChunk], first, last, bKeepCollinear);
+    };
+
+    // The calling thread processes the first chunk itself.
+    vector<thread> threads;
+    threads.reserve(nThreads - 1);
+    for(size_t inxChunk = 1; inxChunk < nThreads; inxChunk++)
+        threads.emplace_back(processChunk, inxChunk);
+    processChunk(0);
+    for(auto& thr : threads)
+        thr.join();
+
+    // Merge the partial hulls skipping the closing point of each loop.
+    DataContainer mergedHulls;
+    for(const auto& partialHull : partialHulls)
+        if(!partialHull.empty())
+            mergedHulls.insert(mergedHulls.end(), partialHull.begin(), partialHull.end() - 1);
+    buildHull2D_mc(convexHull2D, mergedHulls.begin(), mergedHulls.end(), bKeepCollinear);
+
+    size_t nCulled {0};
+    for(size_t count : culledCounts)
+        nCulled += count;
+    return nCulled;
+}
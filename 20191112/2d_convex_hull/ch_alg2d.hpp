@@ -6,6 +6,14 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     11/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the monotone chain engine.
+    17/Oct/2026 - Added the Akl-Toussaint interior point culling stage.
+    17/Oct/2026 - Added the multithreaded engine.
+    17/Oct/2026 - Made the angle scan engine a template on the angle policy.
+    17/Oct/2026 - Documented the parallel sort of prepareData.
+    17/Oct/2026 - Added the collinear point option.
+    17/Oct/2026 - Exposed the angle sort.
+    17/Oct/2026 - Added the angle sort of separate alpha arrays.
 */
 
 
@@ -39,8 +47,83 @@ namespace dk {
     // has significantly more severe impact on performance than this function.
     // The impact of calcConvexHull2D is more severe too.
     void calculateCentroid(const DataContainer&, DataPoint2D& centroid, const size_t subSampleSize = 0) noexcept;
+
+    // The cullInteriorPoints function provides an optional filtering stage
+    // that can run ahead of calculateCentroid/prepareData or ahead of
+    // calcConvexHull2D_mc. It applies the Akl-Toussaint heuristic: it finds
+    // the extreme points of the dataset in eight directions (min/max of x, y,
+    // x+y and x-y), builds the octagon they span and drops every point
+    // located strictly inside the octagon. Such points can't be vertices of
+    // the convex hull. Points on the boundary of the octagon are retained.
+    //
+    // On uniformly distributed datasets the vast majority of points are
+    // discarded in a single linear pass, which shrinks the input of the sort
+    // and of the hull engines accordingly. The order of the remaining points
+    // is not preserved.
+    //
+    // Returns the number of points discarded.
+    size_t cullInteriorPoints(DataContainer& dataStore) noexcept;
+
+    // The prepareData and calcConvexHull2D functions are templates on the
+    // angle policy (see ch_data_point2d.hpp). The default Atan2AnglePolicy
+    // measures true angles with atan2. The PseudoAnglePolicy delivers the
+    // same ordering of points without any transcendental function calls.
+    // Both policies are explicitly instantiated in ch_alg2d.cpp.
+    //
+    // prepareData sorts the points by angle via compact (key, index) pairs
+    // and then permutes the points once. Datasets of 65536 points or more
+    // are sorted with a radix sort on as many threads as the hardware
+    // supports.
+    template <class AnglePolicy = Atan2AnglePolicy>
     void prepareData(DataContainer& dataStore, DataPoint2D& centroid) noexcept;
+    template <class AnglePolicy = Atan2AnglePolicy>
     void calcConvexHull2D(DataContainer& convexHull2D, const DataContainer& dataStore, const DataPoint2D& centroid) noexcept;
+
+    // The sort step of prepareData. Sorts the points by alpha, breaking the
+    // ties by the position of the point in dataStore. Other data preparation
+    // paths call it to arrange the points the same way as prepareData does.
+    void sortByAngle(DataContainer& dataStore);
+
+    // Sorts the indices of nPoints angles the same way as sortByAngle sorts
+    // the points with these angles and stores them in order. It serves the
+    // containers that keep the angles apart from the points.
+    void sortByAngle(const double* alpha, size_t nPoints, std::vector<size_t>& order);
+
+    // The calcConvexHull2D_mc function provides an alternative engine based
+    // on Andrew's monotone chain algorithm. It sorts the dataset once by the
+    // x coordinate (then by y) and builds the lower and upper halves of the
+    // hull in a single linear pass each using cross product orientation
+    // tests. The overall complexity is O(n log n) regardless of the number of
+    // points on the hull.
+    //
+    // The function does not need a centroid and must not be preceded by
+    // prepareData. It sorts dataStore in place to avoid copying the dataset.
+    // The result is a closed counter-clockwise line loop in the same format
+    // as the one delivered by calcConvexHull2D: the last point is a copy of
+    // the first one.
+    //
+    // The orientation tests are evaluated with the robust predicate declared
+    // in ch_pred2d.hpp, so the result is correct on degenerate inputs such
+    // as lattices with many duplicate and collinear points. Collinear points
+    // on the edges of the hull are dropped unless bKeepCollinear is true.
+    void calcConvexHull2D_mc(DataContainer& convexHull2D, DataContainer& dataStore,
+        bool bKeepCollinear = false) noexcept;
+
+    // The calcConvexHull2D_par function is a multithreaded version of
+    // calcConvexHull2D_mc. It splits dataStore into nThreads contiguous
+    // chunks, builds a hull of each chunk on its own thread and merges the
+    // partial hulls into the final closed line loop. If bCull is true then
+    // each thread applies the Akl-Toussaint culling stage to its chunk before
+    // building the partial hull. bKeepCollinear has the same meaning as in
+    // calcConvexHull2D_mc.
+    //
+    // The order of the points in dataStore is not preserved. The function
+    // falls back to a single thread if the dataset is too small to benefit
+    // from parallel processing.
+    //
+    // Returns the number of points culled.
+    size_t calcConvexHull2D_par(DataContainer& convexHull2D, DataContainer& dataStore,
+        size_t nThreads, bool bCull, bool bKeepCollinear = false);
 };   // namespace dk
 
 #endif // ch2d_alg_hpp
@@ -0,0 +1,462 @@
+/* ch_alg3d.cpp
+This module implements the 3D Convex Hull algorithm.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <thread>
+#include "ch_alg3d.hpp"
+
+using namespace std;
+using namespace dk;
+
+static const uint32_t noIndex {UINT32_MAX};
+
+static inline double getCoord(const DataPoint3D& point, int axis) noexcept {
+    return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+// A face of the hull under construction. The neighbour at index i is the
+// face across the edge that runs from vertex i to vertex (i + 1) % 3.
+struct Face3D {
+    uint32_t vertices[3];
+    uint32_t neighbours[3];
+    // The unit normal points outside the hull.
+    DataPoint3D normal;
+    // The points located above the face that haven't been processed yet
+    // along with the farthest one of them.
+    vector<uint32_t> outsidePoints;
+    uint32_t inxFarthest;
+    double farthestDist;
+    // The visibility of the face from the point being added to the hull is
+    // only valid if the tag matches the tag of the current iteration.
+    uint32_t iVisitTag;
+    bool bVisible;
+    bool bAlive;
+};
+
+// The QuickHull3D class builds the convex hull of an array of points. The
+// array must stay intact while the object is in use.
+class QuickHull3D {
+public:
+    QuickHull3D(const DataPoint3D* pPoints, size_t nPoints) noexcept;
+
+    // Builds the hull. Returns false if the points are coplanar.
+    bool build();
+    // Copies the vertices and faces of the hull to the mesh.
+    void getMesh(TriangleMesh3D& mesh) const;
+    // The distance from a face within which a point is treated as lying on
+    // the face.
+    double getTolerance() const noexcept;
+
+private:
+    uint32_t createFace(uint32_t a, uint32_t b, uint32_t c);
+    double calcDistance(const Face3D& face, uint32_t inxPoint) const noexcept;
+    bool createSimplex();
+    void assignPoint(uint32_t inxPoint, const uint32_t* pFaces, size_t nFaces);
+    void addPoint(uint32_t inxFace);
+
+    const DataPoint3D* pPoints_;
+    size_t nPoints_;
+    double epsilon_;
+    vector<Face3D> faces_;
+    // Faces that may have outside points.
+    vector<uint32_t> pendingFaces_;
+    uint32_t iVisitTag_;
+
+    // Buffers reused from one iteration to the next.
+    vector<uint32_t> visibleFaces_;
+    vector<pair<uint32_t, uint32_t>> horizon_;
+    vector<uint32_t> newFaces_;
+    vector<uint32_t> vertexToNewFace_;
+};
+
+QuickHull3D::QuickHull3D(const DataPoint3D* pPoints, size_t nPoints) noexcept
+    : pPoints_{ pPoints }, nPoints_{ nPoints }, epsilon_{ 0.0 }, iVisitTag_{ 0 }
+{
+}
+double QuickHull3D::getTolerance() const noexcept {
+    return epsilon_;
+}
+uint32_t QuickHull3D::createFace(uint32_t a, uint32_t b, uint32_t c) {
+    Face3D face;
+    face.vertices[0] = a;
+    face.vertices[1] = b;
+    face.vertices[2] = c;
+    fill(face.neighbours, face.neighbours + 3, noIndex);
+    face.normal = (pPoints_[b] - pPoints_[a]).cross(pPoints_[c] - pPoints_[a]);
+    double length = sqrt(face.normal.calcLengthSqr());
+    if(length > 0.0) {
+        face.normal.x /= length;
+        face.normal.y /= length;
+        face.normal.z /= length;
+    }
+    face.inxFarthest = noIndex;
+    face.farthestDist = 0.0;
+    face.iVisitTag = 0;
+    face.bVisible = false;
+    face.bAlive = true;
+    faces_.push_back(move(face));
+    return uint32_t(faces_.size() - 1);
+}
+double QuickHull3D::calcDistance(const Face3D& face, uint32_t inxPoint) const noexcept {
+    return face.normal.dot(pPoints_[inxPoint] - pPoints_[face.vertices[0]]);
+}
+
+// Finds four points spanning a tetrahedron of a substantial volume and
+// creates its faces.
+bool QuickHull3D::createSimplex() {
+    // The first two points are the extremes along the axis of the largest
+    // spread.
+    uint32_t inxMin[3] {0, 0, 0};
+    uint32_t inxMax[3] {0, 0, 0};
+    double maxAbs[3] {0.0, 0.0, 0.0};
+    for(uint32_t inx = 0; inx < nPoints_; inx++)
+        for(int axis = 0; axis < 3; axis++) {
+            double coord = getCoord(pPoints_[inx], axis);
+            if(coord < getCoord(pPoints_[inxMin[axis]], axis))
+                inxMin[axis] = inx;
+            if(coord > getCoord(pPoints_[inxMax[axis]], axis))
+                inxMax[axis] = inx;
+            maxAbs[axis] = max(maxAbs[axis], fabs(coord));
+        }
+    // The tolerance accounts for the rounding errors of the distance
+    // calculations relative to the magnitude of the coordinates.
+    epsilon_ = 3.0 * DBL_EPSILON * (maxAbs[0] + maxAbs[1] + maxAbs[2]);
+
+    double maxSpread {-1.0};
+    uint32_t inx0 {0};
+    uint32_t inx1 {0};
+    for(int axis = 0; axis < 3; axis++) {
+        double spread = sqrt((pPoints_[inxMax[axis]] - pPoints_[inxMin[axis]]).calcLengthSqr());
+        if(spread > maxSpread) {
+            maxSpread = spread;
+            inx0 = inxMin[axis];
+            inx1 = inxMax[axis];
+        }
+    }
+    if(maxSpread <= epsilon_)
+        return false;
+
+    // The third point is the farthest from the line through the first two.
+    DataPoint3D direction = pPoints_[inx1] - pPoints_[inx0];
+    double maxDistSqr {0.0};
+    uint32_t inx2 {0};
+    for(uint32_t inx = 0; inx < nPoints_; inx++) {
+        double distSqr = (pPoints_[inx] - pPoints_[inx0]).cross(direction).calcLengthSqr();
+        if(distSqr > maxDistSqr) {
+            maxDistSqr = distSqr;
+            inx2 = inx;
+        }
+    }
+    if(sqrt(maxDistSqr) / maxSpread <= epsilon_)
+        return false;
+
+    // The fourth point is the farthest from the plane through the first three.
+    DataPoint3D normal = direction.cross(pPoints_[inx2] - pPoints_[inx0]);
+    double normalLength = sqrt(normal.calcLengthSqr());
+    double maxDist {0.0};
+    double signedMaxDist {0.0};
+    uint32_t inx3 {0};
+    for(uint32_t inx = 0; inx < nPoints_; inx++) {
+        double dist = normal.dot(pPoints_[inx] - pPoints_[inx0]) / normalLength;
+        if(fabs(dist) > maxDist) {
+            maxDist = fabs(dist);
+            signedMaxDist = dist;
+            inx3 = inx;
+        }
+    }
+    if(maxDist <= epsilon_)
+        return false;
+
+    // The base triangle (inx0, inx2, inx1) must face away from the apex,
+    // i.e. the apex must be above the (inx0, inx1, inx2) triangle.
+    if(signedMaxDist < 0.0)
+        swap(inx1, inx2);
+    uint32_t inxFaces[4] {
+        createFace(inx0, inx2, inx1),
+        createFace(inx2, inx0, inx3),
+        createFace(inx1, inx2, inx3),
+        createFace(inx0, inx1, inx3)
+    };
+
+    // Connect the faces of the tetrahedron across their shared edges.
+    for(uint32_t inxFace : inxFaces)
+        for(int edge = 0; edge < 3; edge++) {
+            uint32_t a = faces_[inxFace].vertices[edge];
+            uint32_t b = faces_[inxFace].vertices[(edge + 1) % 3];
+            for(uint32_t inxOther : inxFaces)
+                for(int otherEdge = 0; otherEdge < 3; otherEdge++)
+                    if(faces_[inxOther].vertices[otherEdge] == b && faces_[inxOther].vertices[(otherEdge + 1) % 3] == a)
+                        faces_[inxFace].neighbours[edge] = inxOther;
+        }
+
+    for(uint32_t inx = 0; inx < nPoints_; inx++)
+        if(inx != inx0 && inx != inx1 && inx != inx2 && inx != inx3)
+            assignPoint(inx, inxFaces, 4);
+    for(uint32_t inxFace : inxFaces)
+        if(!faces_[inxFace].outsidePoints.empty())
+            pendingFaces_.push_back(inxFace);
+    return true;
+}
+
+// Assigns the point to the face of the list it is farthest above. The point
+// is discarded if it isn't above any of the faces.
+void QuickHull3D::assignPoint(uint32_t inxPoint, const uint32_t* pFaces, size_t nFaces) {
+    double maxDist {epsilon_};
+    uint32_t inxBestFace {noIndex};
+    for(size_t inx = 0; inx < nFaces; inx++) {
+        double dist = calcDistance(faces_[pFaces[inx]], inxPoint);
+        if(dist > maxDist) {
+            maxDist = dist;
+            inxBestFace = pFaces[inx];
+        }
+    }
+    if(inxBestFace == noIndex)
+        return;
+
+    Face3D& face = faces_[inxBestFace];
+    face.outsidePoints.push_back(inxPoint);
+    if(maxDist > face.farthestDist) {
+        face.farthestDist = maxDist;
+        face.inxFarthest = inxPoint;
+    }
+}
+
+// Adds the farthest outside point of the face to the hull.
+void QuickHull3D::addPoint(uint32_t inxFace) {
+    uint32_t inxEye = faces_[inxFace].inxFarthest;
+    iVisitTag_++;
+
+    // Collect the faces visible from the eye point. They form a connected
+    // region around the face the point has been assigned to. The edges
+    // between the visible faces and the rest of the hull form the horizon.
+    visibleFaces_.clear();
+    horizon_.clear();
+    faces_[inxFace].iVisitTag = iVisitTag_;
+    faces_[inxFace].bVisible = true;
+    visibleFaces_.push_back(inxFace);
+    for(size_t inx = 0; inx < visibleFaces_.size(); inx++) {
+        uint32_t inxVisible = visibleFaces_[inx];
+        for(uint32_t edge = 0; edge < 3; edge++) {
+            uint32_t inxNeighbour = faces_[inxVisible].neighbours[edge];
+            Face3D& neighbour = faces_[inxNeighbour];
+            if(neighbour.iVisitTag != iVisitTag_) {
+                neighbour.iVisitTag = iVisitTag_;
+                neighbour.bVisible = calcDistance(neighbour, inxEye) > epsilon_;
+                if(neighbour.bVisible)
+                    visibleFaces_.push_back(inxNeighbour);
+            }
+            if(!neighbour.bVisible)
+                horizon_.emplace_back(inxVisible, edge);
+        }
+    }
+
+    // Connect the eye point to every edge of the horizon.
+    if(vertexToNewFace_.size() < nPoints_)
+        vertexToNewFace_.resize(nPoints_);
+    newFaces_.clear();
+    for(const auto& horizonEdge : horizon_) {
+        uint32_t a = faces_[horizonEdge.first].vertices[horizonEdge.second];
+        uint32_t b = faces_[horizonEdge.first].vertices[(horizonEdge.second + 1) % 3];
+        uint32_t inxNeighbour = faces_[horizonEdge.first].neighbours[horizonEdge.second];
+        uint32_t inxNewFace = createFace(a, b, inxEye);
+        faces_[inxNewFace].neighbours[0] = inxNeighbour;
+        for(auto& inxBack : faces_[inxNeighbour].neighbours)
+            if(inxBack == horizonEdge.first)
+                inxBack = inxNewFace;
+        vertexToNewFace_[a] = inxNewFace;
+        newFaces_.push_back(inxNewFace);
+    }
+    // The horizon is a closed loop, so the new face built on the edge (a, b)
+    // shares its edge (b, eye) with the new face built on the edge that
+    // starts at b.
+    for(uint32_t inxNewFace : newFaces_) {
+        uint32_t inxNext = vertexToNewFace_[faces_[inxNewFace].vertices[1]];
+        faces_[inxNewFace].neighbours[1] = inxNext;
+        faces_[inxNext].neighbours[2] = inxNewFace;
+    }
+
+    // Hand the outside points of the visible faces over to the new faces
+    // and retire the visible faces.
+    for(uint32_t inxVisible : visibleFaces_) {
+        vector<uint32_t> outsidePoints;
+        outsidePoints.swap(faces_[inxVisible].outsidePoints);
+        for(uint32_t inxPoint : outsidePoints)
+            if(inxPoint != inxEye)
+                assignPoint(inxPoint, newFaces_.data(), newFaces_.size());
+        faces_[inxVisible].bAlive = false;
+    }
+    for(uint32_t inxNewFace : newFaces_)
+        if(!faces_[inxNewFace].outsidePoints.empty())
+            pendingFaces_.push_back(inxNewFace);
+}
+
+bool QuickHull3D::build() {
+    faces_.clear();
+    pendingFaces_.clear();
+    if(nPoints_ < 4 || !createSimplex())
+        return false;
+
+    while(!pendingFaces_.empty()) {
+        uint32_t inxFace = pendingFaces_.back();
+        pendingFaces_.pop_back();
+        if(faces_[inxFace].bAlive && !faces_[inxFace].outsidePoints.empty())
+            addPoint(inxFace);
+    }
+    return true;
+}
+void QuickHull3D::getMesh(TriangleMesh3D& mesh) const {
+    mesh.vertices.clear();
+    mesh.faces.clear();
+    vector<uint32_t> vertexMap(nPoints_, noIndex);
+    for(const auto& face : faces_) {
+        if(!face.bAlive)
+            continue;
+        array<uint32_t, 3> meshFace;
+        for(int inx = 0; inx < 3; inx++) {
+            uint32_t& inxVertex = vertexMap[face.vertices[inx]];
+            if(inxVertex == noIndex) {
+                inxVertex = uint32_t(mesh.vertices.size());
+                mesh.vertices.push_back(pPoints_[face.vertices[inx]]);
+            }
+            meshFace[inx] = inxVertex;
+        }
+        mesh.faces.push_back(meshFace);
+    }
+}
+
+// Reorders the [first, last) range so that the points located strictly
+// inside the polyhedron spanned by the extreme points are moved to the end.
+// Returns the end of the retained points.
+static DataContainer3D::iterator cullRange3D(DataContainer3D::iterator first,
+        DataContainer3D::iterator last) {
+    size_t nPoints = size_t(last - first);
+    if(nPoints < 4)
+        return last;
+
+    const DataPoint3D directions[14] {
+        {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1},
+        {1, 1, 1}, {-1, -1, -1}, {1, 1, -1}, {-1, -1, 1},
+        {1, -1, 1}, {-1, 1, -1}, {-1, 1, 1}, {1, -1, -1}
+    };
+    DataContainer3D extremes(14, *first);
+    double maxDots[14];
+    for(int inx = 0; inx < 14; inx++)
+        maxDots[inx] = directions[inx].dot(*first);
+    for(auto it = first + 1; it != last; it++)
+        for(int inx = 0; inx < 14; inx++) {
+            double dot = directions[inx].dot(*it);
+            if(dot > maxDots[inx]) {
+                maxDots[inx] = dot;
+                extremes[inx] = *it;
+            }
+        }
+
+    QuickHull3D quickHull(extremes.data(), extremes.size());
+    if(!quickHull.build())
+        return last;
+    TriangleMesh3D polyhedron;
+    quickHull.getMesh(polyhedron);
+
+    // A point is inside if it is below every face of the polyhedron by more
+    // than the tolerance of the hull calculations.
+    struct Plane3D {
+        DataPoint3D normal;
+        double offset;
+    };
+    vector<Plane3D> planes;
+    for(const auto& face : polyhedron.faces) {
+        const DataPoint3D& a = polyhedron.vertices[face[0]];
+        DataPoint3D normal = (polyhedron.vertices[face[1]] - a).cross(polyhedron.vertices[face[2]] - a);
+        double length = sqrt(normal.calcLengthSqr());
+        if(length == 0.0)
+            continue;
+        normal = DataPoint3D{normal.x / length, normal.y / length, normal.z / length};
+        planes.push_back(Plane3D{normal, normal.dot(a)});
+    }
+    double tolerance = 2.0 * quickHull.getTolerance();
+    auto isOutsideOrOnBoundary = [&planes, tolerance](const DataPoint3D& point) {
+        for(const auto& plane : planes)
+            if(plane.normal.dot(point) - plane.offset >= -tolerance)
+                return true;
+        return false;
+    };
+    return partition(first, last, isOutsideOrOnBoundary);
+}
+
+// Public interface functions.
+size_t dk::cullInteriorPoints3D(DataContainer3D& dataStore) {
+    auto it = cullRange3D(dataStore.begin(), dataStore.end());
+    size_t nCulled = size_t(dataStore.end() - it);
+    dataStore.erase(it, dataStore.end());
+    return nCulled;
+}
+void dk::calcConvexHull3D(TriangleMesh3D& convexHull3D, const DataContainer3D& dataStore) {
+    QuickHull3D quickHull(dataStore.data(), dataStore.size());
+    if(quickHull.build())
+        quickHull.getMesh(convexHull3D);
+    else {
+        convexHull3D.vertices.clear();
+        convexHull3D.faces.clear();
+    }
+}
+size_t dk::calcConvexHull3D_par(TriangleMesh3D& convexHull3D, DataContainer3D& dataStore,
+        size_t nThreads, bool bCull) {
+    size_t nPoints = dataStore.size();
+
+    // Don't bother spawning threads for chunks that are too small to benefit.
+    const size_t minChunkSize {4096};
+    nThreads = min(nThreads, nPoints / minChunkSize);
+    if(nThreads < 2) {
+        size_t nCulled {0};
+        if(bCull)
+            nCulled = cullInteriorPoints3D(dataStore);
+        calcConvexHull3D(convexHull3D, dataStore);
+        return nCulled;
+    }
+
+    vector<TriangleMesh3D> partialHulls(nThreads);
+    vector<size_t> culledCounts(nThreads, 0);
+    auto processChunk = [&](size_t inxChunk) {
+        auto first = dataStore.begin() + inxChunk * nPoints / nThreads;
+        auto last = dataStore.begin() + (inxChunk + 1) * nPoints / nThreads;
+        if(bCull) {
+            auto it = cullRange3D(first, last);
+            culledCounts[inxChunk] = size_t(last - it);
+            last = it;
+        }
+        QuickHull3D quickHull(&*first, size_t(last - first));
+        if(quickHull.build())
+            quickHull.getMesh(partialHulls[inxChunk]);
+        else
+            // A degenerate chunk passes all of its points on.
+            partialHulls[inxChunk].vertices.assign(first, last);
+    };
+
+    // The calling thread processes the first chunk itself.
+    vector<thread> threads;
+    threads.reserve(nThreads - 1);
+    for(size_t inxChunk = 1; inxChunk < nThreads; inxChunk++)
+        threads.emplace_back(processChunk, inxChunk);
+    processChunk(0);
+    for(auto& thr : threads)
+        thr.join();
+
+    // Build the final hull of the vertices of the partial hulls.
+    DataContainer3D mergedHulls;
+    for(const auto& partialHull : partialHulls)
+        mergedHulls.insert(mergedHulls.end(), partialHull.vertices.begin(), partialHull.vertices.end());
+    calcConvexHull3D(convexHull3D, mergedHulls);
+
+    size_t nCulled {0};
+    for(size_t count : culledCounts)
+        nCulled += count;
+    return nCulled;
+}
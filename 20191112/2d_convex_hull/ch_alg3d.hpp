@@ -0,0 +1,70 @@
+/* ch_alg3d.hpp
+This module declares facilities required for
+executing the 3D Convex Hull algorithm.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch_alg3d_hpp
+#define ch_alg3d_hpp
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "ch_data_point3d.hpp"
+
+namespace dk {
+    typedef std::vector<DataPoint3D> DataContainer3D;
+
+    // The convex hull in 3D space is a closed triangle mesh. The faces refer
+    // to the vertices by their indices in the vertices container. The
+    // vertices of every face are listed in counter-clockwise order when
+    // viewed from outside the hull.
+    struct TriangleMesh3D {
+        DataContainer3D vertices;
+        std::vector<std::array<uint32_t, 3>> faces;
+    };
+
+    // The cullInteriorPoints3D function is the 3D counterpart of
+    // cullInteriorPoints. It finds the extreme points of the dataset in
+    // fourteen directions (min/max of x, y, z and of the four diagonals
+    // x+y+z, x+y-z, x-y+z and -x+y+z), builds the polyhedron they span and
+    // drops every point located strictly inside the polyhedron.
+    //
+    // The order of the remaining points is not preserved.
+    // Returns the number of points discarded.
+    size_t cullInteriorPoints3D(DataContainer3D& dataStore);
+
+    // The calcConvexHull3D function implements the quickhull algorithm. It
+    // starts off with a tetrahedron spanned by four extreme points and
+    // assigns every point outside the tetrahedron to a face it can see. Then
+    // it repeatedly takes the point farthest from a face, removes the faces
+    // visible from that point and connects the point to the horizon of the
+    // removed faces. The points that end up inside the hull are discarded on
+    // the way. The expected complexity is O(n log n).
+    //
+    // Points located within a small tolerance of an existing face are
+    // treated as lying on the face and don't become vertices. So whether
+    // coplanar points on a flat facet of the hull become vertices depends on
+    // the order in which they are processed, while the shape of the hull
+    // doesn't. If all points are coplanar then the hull is degenerate and the
+    // function delivers an empty mesh.
+    // The dataset may contain up to 2^32 - 1 points.
+    void calcConvexHull3D(TriangleMesh3D& convexHull3D, const DataContainer3D& dataStore);
+
+    // The calcConvexHull3D_par function is a multithreaded version of
+    // calcConvexHull3D. It works like calcConvexHull2D_par does: it splits
+    // dataStore into nThreads contiguous chunks, builds a hull of each chunk
+    // on its own thread (culling interior points first if bCull is true) and
+    // then builds the final hull of the vertices of the partial hulls.
+    //
+    // The order of the points in dataStore is not preserved.
+    // Returns the number of points culled.
+    size_t calcConvexHull3D_par(TriangleMesh3D& convexHull3D, DataContainer3D& dataStore,
+        size_t nThreads, bool bCull);
+};   // namespace dk
+
+#endif // ch_alg3d_hpp
@@ -0,0 +1,63 @@
+/* ch_batch2d.cpp
+This module implements the batch 2D Convex Hull engine that calculates the
+hulls of many independent groups of points in one go.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include "ch_batch2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+size_t dk::calcConvexHulls2D_batch(PointGroups2D& pointGroups, size_t nThreads,
+        bool bCull, const HullSink2D& sink) {
+    auto& groups = pointGroups.groups;
+
+    // Dispatch the largest groups first to keep the tail of the batch short.
+    vector<size_t> dispatchOrder(groups.size());
+    iota(dispatchOrder.begin(), dispatchOrder.end(), size_t(0));
+    stable_sort(dispatchOrder.begin(), dispatchOrder.end(),
+        [&groups](size_t inx1, size_t inx2) { return groups[inx1].size() > groups[inx2].size(); });
+
+    atomic<size_t> inxNext {0};
+    atomic<size_t> nCulled {0};
+    mutex sinkMutex;
+
+    auto worker = [&]() {
+        // The hull buffer keeps its capacity from one group to the next.
+        DataContainer convexHull2D;
+        size_t nCulledLocal {0};
+        for(size_t inx = inxNext++; inx < dispatchOrder.size(); inx = inxNext++) {
+            size_t inxGroup = dispatchOrder[inx];
+            DataContainer& dataStore = groups[inxGroup];
+            if(bCull)
+                nCulledLocal += cullInteriorPoints(dataStore);
+            calcConvexHull2D_mc(convexHull2D, dataStore);
+
+            lock_guard<mutex> lock(sinkMutex);
+            sink(inxGroup, convexHull2D);
+        }
+        nCulled += nCulledLocal;
+    };
+
+    nThreads = max(size_t(1), min(nThreads, groups.size()));
+    vector<thread> threads;
+    threads.reserve(nThreads - 1);
+    for(size_t inxThread = 1; inxThread < nThreads; inxThread++)
+        threads.emplace_back(worker);
+    // The calling thread takes part in the processing too.
+    worker();
+    for(auto& thr : threads)
+        thr.join();
+
+    return nCulled;
+}
@@ -0,0 +1,50 @@
+/* ch_batch2d.hpp
+This module declares the batch 2D Convex Hull engine that calculates the
+hulls of many independent groups of points in one go.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch_batch2d_hpp
+#define ch_batch2d_hpp
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "ch_alg2d.hpp"
+
+namespace dk {
+
+    // Groups of points tagged by keys. The points of the group keys[inx] are
+    // stored in groups[inx]. The groups appear in the order in which their
+    // keys have been encountered in the input.
+    struct PointGroups2D {
+        std::vector<std::string> keys;
+        std::vector<DataContainer> groups;
+    };
+
+    // Receives the convex hull of the group identified by its index.
+    typedef std::function<void(size_t inxGroup, const DataContainer& convexHull2D)> HullSink2D;
+
+    // Calculates the convex hull of every group using the monotone chain
+    // engine and passes each hull to the sink as soon as it is ready. The
+    // points of each group are reordered in place.
+    //
+    // The groups are processed by a pool of nThreads threads. The largest
+    // groups are dispatched first and every thread claims the next group as
+    // soon as it is done with the previous one, so a few large groups don't
+    // hold up the rest of the batch. Each thread reuses its own hull buffer
+    // across the groups it processes. The sink is never called concurrently,
+    // but the order of the calls depends on the timing of the threads.
+    //
+    // Set bCull to true to cull the interior points of each group first.
+    // Returns the total number of points culled.
+    size_t calcConvexHulls2D_batch(PointGroups2D& pointGroups, size_t nThreads,
+        bool bCull, const HullSink2D& sink);
+
+};   // namespace dk
+
+#endif // ch_batch2d_hpp
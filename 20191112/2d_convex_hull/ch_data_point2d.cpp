@@ -7,6 +7,8 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     11/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the pseudo-angle.
+    17/Oct/2026 - Exposed the angle calculations on precalculated products.
 */
 
 #include <algorithm>
@@ -76,6 +78,9 @@ void DataPoint2D::calcAlpha(const DataPoint2D& tip, const DataPoint2D& origin) n
 double DataPoint2D::calcAngle(const DataPoint2D& v1, const DataPoint2D& v2) noexcept {
     double dotProduct = v2.x * v1.x + v2.y * v1.y;
     double determinant = v2.x * v1.y - v2.y * v1.x;
+    return calcAngleOfProducts(dotProduct, determinant);
+}
+double DataPoint2D::calcAngleOfProducts(double dotProduct, double determinant) noexcept {
     double angle = atan2(determinant, dotProduct);
 
     // Make the angle vary in the [0, 2*Pi) domain to preclude interruption of continuity
@@ -88,3 +93,24 @@ double DataPoint2D::calcAngle(const DataPoint2D& v1, const DataPoint2D& v2) noex
     return angle;
 }
 
+double DataPoint2D::calcPseudoAngle(const DataPoint2D& v1, const DataPoint2D& v2) noexcept {
+    // These are the same quantities atan2 is applied to in calcAngle.
+    double dotProduct = v2.x * v1.x + v2.y * v1.y;
+    double determinant = v2.x * v1.y - v2.y * v1.x;
+    return calcPseudoAngleOfProducts(dotProduct, determinant);
+}
+double DataPoint2D::calcPseudoAngleOfProducts(double dotProduct, double determinant) noexcept {
+    // The orientation of the vectors (the sign of the determinant) and the
+    // sign of the dot product select one of the four quadrants. Within a
+    // quadrant the ratio of the two values grows monotonically with the angle.
+    if(determinant >= 0.0) {
+        if(dotProduct > 0.0)
+            return determinant / (dotProduct + determinant);
+        if(determinant == 0.0 && dotProduct == 0.0)
+            return 0.0;
+        return 1.0 - dotProduct / (determinant - dotProduct);
+    }
+    if(dotProduct < 0.0)
+        return 2.0 - determinant / (-dotProduct - determinant);
+    return 3.0 + dotProduct / (dotProduct - determinant);
+}
@@ -7,6 +7,8 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     11/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the pseudo-angle and the angle policies.
+    17/Oct/2026 - Exposed the angle calculations on precalculated products.
 */
 
 #ifndef ch_data_point2d_hpp
@@ -58,6 +60,49 @@ namespace dk {
         // of zero and the right boundary is exclusive of 2*Pi.
         // An angle between a vector and itself equals 0.
         static double calcAngle(const DataPoint2D&, const DataPoint2D&) noexcept;
+
+        // Calculates a pseudo-angle (also known as the diamond angle) between
+        // the first and second vector represented by the function arguments.
+        // The pseudo-angle is in the [0, 4) domain and is a strictly
+        // increasing function of the angle calculated by calcAngle, so it
+        // delivers the same ordering. It is derived from the signs and ratio
+        // of the dot product and the cross product of the vectors and doesn't
+        // call any transcendental functions.
+        // A pseudo-angle between a vector and itself equals 0, and so does a
+        // pseudo-angle involving a zero vector.
+        static double calcPseudoAngle(const DataPoint2D&, const DataPoint2D&) noexcept;
+
+        // These functions deliver the same results as calcAngle and
+        // calcPseudoAngle given the dot product and the determinant of the
+        // vectors those functions calculate first. They let callers that
+        // calculate the products in bulk share the rest of the calculation.
+        static double calcAngleOfProducts(double dotProduct, double determinant) noexcept;
+        static double calcPseudoAngleOfProducts(double dotProduct, double determinant) noexcept;
+    };
+
+    // Angle policies of the angle scan engine. Each policy provides a static
+    // calcAngle function with the same signature and ordering semantics as
+    // DataPoint2D::calcAngle, along with a calcAngleOfProducts counterpart.
+    // See prepareData and calcConvexHull2D.
+
+    // Measures true angles using atan2.
+    struct Atan2AnglePolicy {
+        static double calcAngle(const DataPoint2D& v1, const DataPoint2D& v2) noexcept {
+            return DataPoint2D::calcAngle(v1, v2);
+        }
+        static double calcAngleOfProducts(double dotProduct, double determinant) noexcept {
+            return DataPoint2D::calcAngleOfProducts(dotProduct, determinant);
+        }
+    };
+
+    // Measures pseudo-angles without transcendental function calls.
+    struct PseudoAnglePolicy {
+        static double calcAngle(const DataPoint2D& v1, const DataPoint2D& v2) noexcept {
+            return DataPoint2D::calcPseudoAngle(v1, v2);
+        }
+        static double calcAngleOfProducts(double dotProduct, double determinant) noexcept {
+            return DataPoint2D::calcPseudoAngleOfProducts(dotProduct, determinant);
+        }
     };
 
 };   // namespace dk
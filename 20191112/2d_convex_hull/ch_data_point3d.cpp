@@ -0,0 +1,28 @@
+/* ch_data_point3d.cpp
+This module implements the DataPoint3D data structure.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#include "ch_data_point3d.hpp"
+
+using namespace dk;
+
+DataPoint3D DataPoint3D::operator - (const DataPoint3D& point) const noexcept {
+    return DataPoint3D{x - point.x, y - point.y, z - point.z};
+}
+double DataPoint3D::dot(const DataPoint3D& v) const noexcept {
+    return x * v.x + y * v.y + z * v.z;
+}
+DataPoint3D DataPoint3D::cross(const DataPoint3D& v) const noexcept {
+    return DataPoint3D{y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x};
+}
+double DataPoint3D::calcLengthSqr() const noexcept {
+    return dot(*this);
+}
+bool DataPoint3D::operator == (const DataPoint3D& point) const noexcept {
+    return x == point.x && y == point.y && z == point.z;
+}
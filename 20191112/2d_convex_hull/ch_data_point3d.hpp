@@ -0,0 +1,39 @@
+/* ch_data_point3d.hpp
+This module declares the DataPoint3D data structure along with the vector
+operations required in this implementation of the 3D Convex Hull algorithm.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch_data_point3d_hpp
+#define ch_data_point3d_hpp
+
+namespace dk {
+
+    struct DataPoint3D {
+        double x {0};
+        double y {0};
+        double z {0};
+
+        // Returns a result of subtraction of the point represented
+        // by the argument from (*this) point.
+        DataPoint3D operator - (const DataPoint3D&) const noexcept;
+
+        // Calculates the dot product of (*this) and the argument.
+        double dot(const DataPoint3D&) const noexcept;
+
+        // Calculates the cross product of (*this) and the argument.
+        DataPoint3D cross(const DataPoint3D&) const noexcept;
+
+        // Calculates the squared length of the vector.
+        double calcLengthSqr() const noexcept;
+
+        bool operator == (const DataPoint3D&) const noexcept;
+    };
+
+};   // namespace dk
+
+#endif // ch_data_point3d_hpp
@@ -0,0 +1,376 @@
+/* ch_dyn2d.cpp
+This module implements the dynamic 2D Convex Hull engine.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#include <algorithm>
+#include "ch_dyn2d.hpp"
+#include "ch_pred2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+// Rotating the plane by 180 degrees turns the lower hull into the upper
+// hull and reverses the order of the points, while the orientation of any
+// three points stays the same. So the lower hull is the upper hull of the
+// tree read from right to left: Chain<true> swaps the subtrees and the
+// comparisons and leaves the orientation tests alone.
+//
+// A chain is the hull of a subtree restricted to the vertices between two
+// bounds, which are vertices of the chain themselves. A null bound means
+// the chain isn't restricted on that side.
+template<bool bLower>
+struct DynamicHull2D::Chain {
+    static const Node* first(const Node* node) noexcept {
+        return bLower ? node->right : node->left;
+    }
+    static const Node* second(const Node* node) noexcept {
+        return bLower ? node->left : node->right;
+    }
+    static const Node* const* bridge(const Node* node) noexcept {
+        return bLower ? node->lowerBridge : node->upperBridge;
+    }
+    static const Node** bridge(Node* node) noexcept {
+        return bLower ? node->lowerBridge : node->upperBridge;
+    }
+    // Returns true if the leaf comes before the other leaf in the chain.
+    static bool precedes(const Node* leaf1, const Node* leaf2) noexcept {
+        if(bLower)
+            swap(leaf1, leaf2);
+        return leaf1->x < leaf2->x || (leaf1->x == leaf2->x && leaf1->y < leaf2->y);
+    }
+
+    // The hull of an internal node consists of the hull of the first
+    // subtree up to the first end of the bridge and of the hull of the
+    // second subtree from the second end on. If the bridge is outside the
+    // bounds then the bounded chain is confined to one of the subtrees, so
+    // the function moves down to that subtree and returns true.
+    static bool skipBridge(const Node*& node, const Node*& lowerBound, const Node*& upperBound) noexcept {
+        const Node* const* ends = bridge(node);
+        if(upperBound != nullptr && precedes(upperBound, ends[1])) {
+            if(precedes(ends[0], upperBound))
+                upperBound = ends[0];
+            node = first(node);
+            return true;
+        }
+        if(lowerBound != nullptr && precedes(ends[0], lowerBound)) {
+            if(precedes(lowerBound, ends[1]))
+                lowerBound = ends[1];
+            node = second(node);
+            return true;
+        }
+        return false;
+    }
+
+    // Finds the vertex of the hull of the subtree that is the farthest to
+    // the left of the directed line (a, b). The distance from the line is a
+    // unimodal function of the position along the hull, so the search
+    // follows the direction of the bridge at every node.
+    static const Node* findExtreme(const Node* node, const Node* a, const Node* b) noexcept {
+        const Node* lowerBound {nullptr};
+        const Node* upperBound {nullptr};
+        while(node->left != nullptr) {
+            if(skipBridge(node, lowerBound, upperBound))
+                continue;
+            const Node* const* ends = bridge(node);
+            if(calcEdgeOrientation2D(a->x, a->y, b->x, b->y,
+                    ends[0]->x, ends[0]->y, ends[1]->x, ends[1]->y) > 0.0) {
+                lowerBound = ends[1];
+                node = second(node);
+            }
+            else {
+                upperBound = ends[0];
+                node = first(node);
+            }
+        }
+        return node;
+    }
+
+    // Finds the point of contact of the tangent from the point, which
+    // precedes the subtree, to the hull of the subtree. If several vertices
+    // are on the tangent then the farthest one is taken.
+    static const Node* findTangent(const Node* node, const Node* point) noexcept {
+        const Node* lowerBound {nullptr};
+        const Node* upperBound {nullptr};
+        while(node->left != nullptr) {
+            if(skipBridge(node, lowerBound, upperBound))
+                continue;
+            const Node* const* ends = bridge(node);
+            if(calcOrientation2D(point->x, point->y, ends[0]->x, ends[0]->y, ends[1]->x, ends[1]->y) >= 0.0) {
+                lowerBound = ends[1];
+                node = second(node);
+            }
+            else {
+                upperBound = ends[0];
+                node = first(node);
+            }
+        }
+        return node;
+    }
+
+    // Calculates the bridge of the node from the hulls of its subtrees.
+    // An edge of the hull of the first subtree precedes the first end of the
+    // bridge if, and only if, the whole second subtree is strictly below the
+    // line the edge is on. Binary search for the first edge that fails the
+    // test delivers the first end of the bridge, which is the nearest one if
+    // the bridge is on the same line as some edges. The second end is the
+    // point of contact of the tangent from the first end.
+    static void findBridge(Node* node) noexcept {
+        const Node* firstSubtree = first(node);
+        const Node* secondSubtree = second(node);
+        const Node* lowerBound {nullptr};
+        const Node* upperBound {nullptr};
+        const Node* current = firstSubtree;
+        while(current->left != nullptr) {
+            if(skipBridge(current, lowerBound, upperBound))
+                continue;
+            const Node* const* ends = bridge(current);
+            const Node* extreme = findExtreme(secondSubtree, ends[0], ends[1]);
+            if(calcOrientation2D(ends[0]->x, ends[0]->y, ends[1]->x, ends[1]->y, extreme->x, extreme->y) >= 0.0) {
+                upperBound = ends[0];
+                current = first(current);
+            }
+            else {
+                lowerBound = ends[1];
+                current = second(current);
+            }
+        }
+        const Node** ends = bridge(node);
+        ends[0] = current;
+        ends[1] = findTangent(secondSubtree, current);
+    }
+
+    // Returns true if the leaf, which is in the given subtree of the node,
+    // is on the part of the hull of the subtree that is included in the
+    // hull of the node. Provided that the leaf is a vertex of the hull of
+    // the subtree, it is a vertex of the hull of the node too.
+    static bool isOnHull(const Node* node, const Node* subtree, const Node* leaf) noexcept {
+        const Node* const* ends = bridge(node);
+        return subtree == first(node) ? !precedes(ends[0], leaf) : !precedes(leaf, ends[1]);
+    }
+
+    // Appends the vertices of the bounded chain of the subtree to the
+    // container in the order of the chain.
+    static void collect(const Node* node, const Node* lowerBound, const Node* upperBound,
+            vector<const Node*>& chain) {
+        while(node->left != nullptr) {
+            const Node* const* ends = bridge(node);
+            bool bFirst = lowerBound == nullptr || !precedes(ends[0], lowerBound);
+            bool bSecond = upperBound == nullptr || !precedes(upperBound, ends[1]);
+            if(bFirst && bSecond) {
+                collect(first(node), lowerBound,
+                    upperBound != nullptr && precedes(upperBound, ends[0]) ? upperBound : ends[0], chain);
+                if(lowerBound == nullptr || precedes(lowerBound, ends[1]))
+                    lowerBound = ends[1];
+                node = second(node);
+            }
+            else if(bFirst) {
+                if(upperBound == nullptr || precedes(ends[0], upperBound))
+                    upperBound = ends[0];
+                node = first(node);
+            }
+            else {
+                if(lowerBound == nullptr || precedes(lowerBound, ends[1]))
+                    lowerBound = ends[1];
+                node = second(node);
+            }
+        }
+        chain.push_back(node);
+    }
+};
+
+DynamicHull2D::DynamicHull2D()
+    : root_{ nullptr }, iPointCount_{ 0 }
+{
+}
+DynamicHull2D::Node* DynamicHull2D::allocateNode() {
+    if(freeNodes_.empty()) {
+        nodePool_.emplace_back();
+        return &nodePool_.back();
+    }
+    Node* node = freeNodes_.back();
+    freeNodes_.pop_back();
+    *node = Node();
+    return node;
+}
+void DynamicHull2D::releaseNode(Node* node) noexcept {
+    freeNodes_.push_back(node);
+}
+void DynamicHull2D::replaceChild(Node* parent, Node* child, Node* newChild) noexcept {
+    newChild->parent = parent;
+    if(parent == nullptr)
+        root_ = newChild;
+    else if(parent->left == child)
+        parent->left = newChild;
+    else
+        parent->right = newChild;
+}
+void DynamicHull2D::rotateUp(Node* node) noexcept {
+    // The point an internal node holds separates its subtrees, so it stays
+    // valid after the rotation.
+    Node* parent = node->parent;
+    replaceChild(parent->parent, parent, node);
+    if(parent->left == node) {
+        parent->left = node->right;
+        parent->left->parent = parent;
+        node->right = parent;
+    }
+    else {
+        parent->right = node->left;
+        parent->right->parent = parent;
+        node->left = parent;
+    }
+    parent->parent = node;
+}
+void DynamicHull2D::updateBridges(Node* node) noexcept {
+    Chain<false>::findBridge(node);
+    Chain<true>::findBridge(node);
+}
+void DynamicHull2D::updatePath(Node* node, const Node* subtree, const Node* leaf,
+        bool bUpper, bool bLower, bool bInserted) noexcept {
+    // The hulls of a node depend on the hulls of its subtrees only. So once
+    // the leaf is off both hulls of a subtree the hulls of the ancestors
+    // don't change, which is what keeps most updates short: a random point
+    // drops off the hulls a few levels above its leaf.
+    for(; node != nullptr && (bUpper || bLower); subtree = node, node = node->parent) {
+        // The bridges tell if the inserted leaf is on the new hulls of the
+        // node and if the erased one was on the old hulls.
+        bool bUpperChanged {bUpper};
+        bool bLowerChanged {bLower};
+        if(!bInserted) {
+            bUpper = bUpper && Chain<false>::isOnHull(node, subtree, leaf);
+            bLower = bLower && Chain<true>::isOnHull(node, subtree, leaf);
+        }
+        if(bUpperChanged)
+            Chain<false>::findBridge(node);
+        if(bLowerChanged)
+            Chain<true>::findBridge(node);
+        if(bInserted) {
+            bUpper = bUpper && Chain<false>::isOnHull(node, subtree, leaf);
+            bLower = bLower && Chain<true>::isOnHull(node, subtree, leaf);
+        }
+    }
+}
+
+void DynamicHull2D::insert(const DataPoint2D& point) {
+    iPointCount_++;
+    Node* leaf = root_;
+    if(leaf != nullptr)
+        while(leaf->left != nullptr)
+            leaf = point.x < leaf->x || (point.x == leaf->x && point.y <= leaf->y) ? leaf->left : leaf->right;
+    if(leaf != nullptr && leaf->x == point.x && leaf->y == point.y) {
+        leaf->count++;
+        return;
+    }
+
+    Node* newLeaf = allocateNode();
+    newLeaf->x = point.x;
+    newLeaf->y = point.y;
+    newLeaf->count = 1;
+    if(leaf == nullptr) {
+        root_ = newLeaf;
+        return;
+    }
+
+    // The new leaf and the leaf it has landed on become the children of a
+    // new internal node, which then floats up to its place in the treap.
+    Node* node = allocateNode();
+    node->priority = priorityEngine_();
+    replaceChild(leaf->parent, leaf, node);
+    bool bNewFirst = point.x < leaf->x || (point.x == leaf->x && point.y < leaf->y);
+    node->left = bNewFirst ? newLeaf : leaf;
+    node->right = bNewFirst ? leaf : newLeaf;
+    node->x = node->left->x;
+    node->y = node->left->y;
+    newLeaf->parent = leaf->parent = node;
+
+    // A rotation changes the subtrees of the former parent only, and they
+    // don't change any more afterwards.
+    while(node->parent != nullptr && node->parent->priority < node->priority) {
+        Node* parent = node->parent;
+        rotateUp(node);
+        updateBridges(parent);
+    }
+
+    // The new leaf is a vertex of its own hulls. Check if it is still on the
+    // hulls of the subtree of the new node.
+    bool bUpper {true};
+    bool bLower {true};
+    const Node* subtree = newLeaf;
+    for(const Node* parent = newLeaf->parent; parent != node; subtree = parent, parent = parent->parent) {
+        bUpper = bUpper && Chain<false>::isOnHull(parent, subtree, newLeaf);
+        bLower = bLower && Chain<true>::isOnHull(parent, subtree, newLeaf);
+    }
+    updatePath(node, subtree, newLeaf, bUpper, bLower, true);
+}
+bool DynamicHull2D::erase(const DataPoint2D& point) {
+    Node* leaf = root_;
+    if(leaf == nullptr)
+        return false;
+    while(leaf->left != nullptr)
+        leaf = point.x < leaf->x || (point.x == leaf->x && point.y <= leaf->y) ? leaf->left : leaf->right;
+    if(leaf->x != point.x || leaf->y != point.y)
+        return false;
+
+    iPointCount_--;
+    if(--leaf->count > 0)
+        return true;
+
+    // The sibling of the leaf takes the place of their parent. The
+    // priorities of the sibling subtree don't exceed that of the parent, so
+    // the treap needs no rotations.
+    Node* parent = leaf->parent;
+    if(parent == nullptr)
+        root_ = nullptr;
+    else {
+        Node* sibling = parent->left == leaf ? parent->right : parent->left;
+        Node* grandParent = parent->parent;
+        bool bUpper = Chain<false>::isOnHull(parent, leaf, leaf);
+        bool bLower = Chain<true>::isOnHull(parent, leaf, leaf);
+        replaceChild(grandParent, parent, sibling);
+        releaseNode(parent);
+        updatePath(grandParent, sibling, leaf, bUpper, bLower, false);
+    }
+    releaseNode(leaf);
+    return true;
+}
+void DynamicHull2D::clear() noexcept {
+    root_ = nullptr;
+    iPointCount_ = 0;
+    nodePool_.clear();
+    freeNodes_.clear();
+}
+void DynamicHull2D::getHull(DataContainer& convexHull2D) const {
+    convexHull2D.clear();
+    if(root_ == nullptr)
+        return;
+
+    // The upper hull runs from the leftmost point to the rightmost one and
+    // the lower hull runs back, so together they make a clockwise loop.
+    vector<const Node*> chain;
+    Chain<false>::collect(root_, nullptr, nullptr, chain);
+    size_t iUpperSize = chain.size();
+    Chain<true>::collect(root_, nullptr, nullptr, chain);
+
+    DataPoint2D point;
+    auto appendPoint = [&convexHull2D, &point](const Node* leaf) {
+        point.x = leaf->x;
+        point.y = leaf->y;
+        convexHull2D.push_back(point);
+    };
+    // Reverse the loop skipping the rightmost point shared by the two
+    // halves. The leftmost point appears at both ends and closes the loop.
+    for(size_t inx = chain.size(); inx-- > iUpperSize + 1; )
+        appendPoint(chain[inx]);
+    for(size_t inx = iUpperSize; inx-- > 0; )
+        appendPoint(chain[inx]);
+    if(convexHull2D.size() == 1)
+        convexHull2D.push_back(convexHull2D.front());
+}
+size_t DynamicHull2D::getPointCount() const noexcept {
+    return iPointCount_;
+}
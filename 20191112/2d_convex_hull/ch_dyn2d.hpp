@@ -0,0 +1,111 @@
+/* ch_dyn2d.hpp
+This module declares the dynamic 2D Convex Hull engine that supports
+deletion of points as well as insertion.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch_dyn2d_hpp
+#define ch_dyn2d_hpp
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+#include "ch_alg2d.hpp"
+
+namespace dk {
+
+    // The DynamicHull2D class maintains the convex hull of a set of points
+    // that changes over time. Unlike IncrementalHull2D it retains all the
+    // points, so any of them can be erased later and the points hidden under
+    // the erased vertices reappear on the hull.
+    //
+    // The structure follows Overmars and van Leeuwen. The distinct points
+    // are stored in the leaves of a binary search tree ordered by x and then
+    // by y. Every internal node holds the bridges, i.e. the common tangents,
+    // of the upper and of the lower hulls of its two subtrees. The hull of a
+    // subtree is not stored anywhere: it is the hull of its left subtree up
+    // to the bridge followed by the hull of its right subtree from the
+    // bridge on, so the bridges of a node can be found by descending both
+    // subtrees. The tree is a treap, so its expected depth is O(log n) and
+    // an insertion or an erasure recalculates the bridges of O(log n) nodes
+    // on the path to the root. A bridge is found with a binary search over
+    // one subtree that probes the other one with a binary search of its
+    // own, which makes an update cost O(log^3 n) expected time. Retrieving
+    // the hull costs O(h log n) time where h is the size of the hull.
+    //
+    // Collinear points are dropped from the hull. All orientation tests are
+    // exact, see calcOrientation2D.
+    class DynamicHull2D {
+    public:
+        DynamicHull2D();
+        DynamicHull2D(const DynamicHull2D&) = delete;
+        DynamicHull2D& operator=(const DynamicHull2D&) = delete;
+
+        // Adds the point to the set. Duplicate points are counted.
+        void insert(const DataPoint2D& point);
+
+        // Removes one occurrence of the point from the set. Returns false if
+        // the set doesn't contain the point.
+        bool erase(const DataPoint2D& point);
+
+        void clear() noexcept;
+
+        // Populates the container with a closed counter-clockwise line loop
+        // of the current hull in the same format as calcConvexHull2D_mc.
+        void getHull(DataContainer& convexHull2D) const;
+
+        // The number of points in the set counting the duplicates.
+        size_t getPointCount() const noexcept;
+
+    private:
+        struct Node {
+            Node* left {nullptr};
+            Node* right {nullptr};
+            Node* parent {nullptr};
+            // The point of a leaf. An internal node holds the largest point
+            // of its left subtree to guide the searches.
+            double x {0};
+            double y {0};
+            // The number of occurrences of the point of a leaf.
+            size_t count {0};
+            // The priority of an internal node in the treap.
+            uint64_t priority {0};
+            // The leaves at the ends of the bridges of the upper and the
+            // lower hulls. The first end is in the left subtree for the
+            // upper hull and in the right subtree for the lower one.
+            const Node* upperBridge[2] {nullptr, nullptr};
+            const Node* lowerBridge[2] {nullptr, nullptr};
+        };
+
+        // The upper hull of a subtree and its lower hull traversed from
+        // right to left are handled by the same code, see ch_dyn2d.cpp.
+        template<bool bLower> struct Chain;
+
+        Node* allocateNode();
+        void releaseNode(Node* node) noexcept;
+        void replaceChild(Node* parent, Node* child, Node* newChild) noexcept;
+        void rotateUp(Node* node) noexcept;
+        static void updateBridges(Node* node) noexcept;
+        // Recalculates the bridges of the node and of its ancestors after
+        // the leaf has been inserted into or erased from the subtree of the
+        // node. The flags tell if the leaf is on the upper and the lower
+        // hulls of the subtree.
+        void updatePath(Node* node, const Node* subtree, const Node* leaf,
+            bool bUpper, bool bLower, bool bInserted) noexcept;
+
+        Node* root_;
+        size_t iPointCount_;
+        // The nodes are allocated from a pool and recycled.
+        std::deque<Node> nodePool_;
+        std::vector<Node*> freeNodes_;
+        std::mt19937_64 priorityEngine_;
+    };
+
+};   // namespace dk
+
+#endif // ch_dyn2d_hpp
@@ -0,0 +1,139 @@
+/* ch_inc2d.cpp
+This module implements the incremental 2D Convex Hull engine.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Switched to the robust orientation predicate.
+    17/Oct/2026 - Matched the statement style of the directory.
+*/
+
+#include <iterator>
+#include "ch_inc2d.hpp"
+#include "ch_pred2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+// Calculates the z component of the cross product of (a - o) and (b - o).
+// Negative values indicate a clockwise turn at a, which is what the
+// vertices of an upper hull traversed from left to right must deliver.
+// The sign is exact, see calcOrientation2D.
+static inline double cross(double ox, double oy, double ax, double ay, double bx, double by) noexcept {
+    return calcOrientation2D(ox, oy, ax, ay, bx, by);
+}
+
+bool UpperHull2D::insert(double x, double y) {
+    auto it = vertices_.lower_bound(x);
+
+    if(it != vertices_.end() && it->first == x) {
+        // A vertex with the same x coordinate dominates the point unless it
+        // is located lower.
+        if(it->second >= y)
+            return false;
+        it = vertices_.erase(it);
+    }
+    else if(it != vertices_.end() && it != vertices_.begin()) {
+        // The point is located between two vertices. Discard it if it's not
+        // above the edge connecting them.
+        auto prev = std::prev(it);
+        if(cross(prev->first, prev->second, it->first, it->second, x, y) <= 0.0)
+            return false;
+    }
+
+    it = vertices_.emplace_hint(it, x, y);
+
+    // Remove the vertices to the right that don't make a clockwise turn
+    // any more.
+    auto next = std::next(it);
+    while(next != vertices_.end()) {
+        auto nextNext = std::next(next);
+        if(nextNext == vertices_.end()
+            || cross(x, y, next->first, next->second, nextNext->first, nextNext->second) < 0.0)
+            break;
+        vertices_.erase(next);
+        next = nextNext;
+    }
+
+    // Same to the left.
+    while(it != vertices_.begin()) {
+        auto prev = std::prev(it);
+        if(prev == vertices_.begin())
+            break;
+        auto prevPrev = std::prev(prev);
+        if(cross(prevPrev->first, prevPrev->second, prev->first, prev->second, x, y) < 0.0)
+            break;
+        vertices_.erase(prev);
+    }
+    return true;
+}
+void UpperHull2D::clear() noexcept {
+    vertices_.clear();
+}
+size_t UpperHull2D::size() const noexcept {
+    return vertices_.size();
+}
+UpperHull2D::const_iterator UpperHull2D::begin() const noexcept {
+    return vertices_.begin();
+}
+UpperHull2D::const_iterator UpperHull2D::end() const noexcept {
+    return vertices_.end();
+}
+
+IncrementalHull2D::IncrementalHull2D() noexcept
+    : iPointCount_{ 0 }
+{
+}
+void IncrementalHull2D::insert(const DataPoint2D& point) {
+    upperHull_.insert(point.x, point.y);
+    lowerHull_.insert(point.x, -point.y);
+    iPointCount_++;
+}
+void IncrementalHull2D::insert(DataContainer& batch) {
+    if(batch.empty())
+        return;
+    calcConvexHull2D_mc(batchHull_, batch);
+    for(size_t inx = 0; inx + 1 < batchHull_.size(); inx++) {
+        upperHull_.insert(batchHull_[inx].x, batchHull_[inx].y);
+        lowerHull_.insert(batchHull_[inx].x, -batchHull_[inx].y);
+    }
+    iPointCount_ += batch.size();
+}
+void IncrementalHull2D::clear() noexcept {
+    upperHull_.clear();
+    lowerHull_.clear();
+    iPointCount_ = 0;
+}
+void IncrementalHull2D::getHull(DataContainer& convexHull2D) const {
+    convexHull2D.clear();
+    if(upperHull_.size() == 0)
+        return;
+
+    DataPoint2D point;
+    auto appendPoint = [&convexHull2D, &point](double x, double y) {
+        point.x = x;
+        point.y = y;
+        if(convexHull2D.empty() || convexHull2D.back().x != x || convexHull2D.back().y != y)
+            convexHull2D.push_back(point);
+    };
+
+    // Walk the lower hull from left to right, then the upper hull from
+    // right to left. The two halves share their end points unless there
+    // are several points with the extreme x coordinates.
+    for(const auto& vertex : lowerHull_)
+        appendPoint(vertex.first, -vertex.second);
+    for(auto it = upperHull_.end(); it != upperHull_.begin(); ) {
+        --it;
+        appendPoint(it->first, it->second);
+    }
+
+    // Close the line loop.
+    if(convexHull2D.size() > 1 && convexHull2D.back().x == convexHull2D.front().x
+            && convexHull2D.back().y == convexHull2D.front().y)
+        return;
+    convexHull2D.push_back(convexHull2D.front());
+}
+size_t IncrementalHull2D::getPointCount() const noexcept {
+    return iPointCount_;
+}
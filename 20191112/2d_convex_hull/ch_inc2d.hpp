@@ -0,0 +1,78 @@
+/* ch_inc2d.hpp
+This module declares the incremental 2D Convex Hull engine that processes
+unbounded streams of points.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch_inc2d_hpp
+#define ch_inc2d_hpp
+
+#include <map>
+#include "ch_alg2d.hpp"
+
+namespace dk {
+
+    // Maintains an upper hull, i.e. the part of the convex hull that is
+    // visible from above, in a map ordered by the x coordinate. Points that
+    // fall under the hull are discarded on arrival and so are the hull
+    // vertices that stop being vertices. Collinear points are discarded too.
+    class UpperHull2D {
+    public:
+        // Returns true if the point has become a vertex of the upper hull.
+        bool insert(double x, double y);
+        void clear() noexcept;
+        size_t size() const noexcept;
+
+        typedef std::map<double, double>::const_iterator const_iterator;
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+    private:
+        // Maps x to y of the vertices of the upper hull.
+        std::map<double, double> vertices_;
+    };
+
+    // The IncrementalHull2D class maintains the convex hull of all points
+    // inserted so far. Only the vertices of the hull are retained, so the
+    // memory footprint is proportional to the size of the hull rather than
+    // the number of points inserted. An insertion costs O(log h) amortised
+    // time where h is the size of the hull.
+    //
+    // The hull is kept as two halves ordered by the x coordinate: the upper
+    // hull of the points and the upper hull of the points reflected about
+    // the x axis, which is the lower hull.
+    class IncrementalHull2D {
+    public:
+        IncrementalHull2D() noexcept;
+
+        void insert(const DataPoint2D& point);
+
+        // Inserts a batch of points. The batch is reduced to its own hull
+        // first, so only the vertices of the hull of the batch have to be
+        // inserted into the ordered structure. The batch is reordered.
+        void insert(DataContainer& batch);
+
+        void clear() noexcept;
+
+        // Populates the container with a closed counter-clockwise line loop
+        // of the current hull in the same format as calcConvexHull2D_mc.
+        void getHull(DataContainer& convexHull2D) const;
+
+        // The number of points inserted so far.
+        size_t getPointCount() const noexcept;
+
+    private:
+        UpperHull2D upperHull_;
+        // Keeps the lower hull reflected about the x axis.
+        UpperHull2D lowerHull_;
+        size_t iPointCount_;
+        DataContainer batchHull_;
+    };
+
+};   // namespace dk
+
+#endif // ch_inc2d_hpp
@@ -0,0 +1,660 @@
+/* ch_io2d.cpp
+This module implements the input/output facilities of the 2D Convex Hull
+application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Added the binary point cloud format.
+    17/Oct/2026 - Added the chunked stream reader.
+    17/Oct/2026 - Added the grouped input file reader.
+    17/Oct/2026 - Shared the parsing helpers with the 3D reader.
+    17/Oct/2026 - Added the reader of the compact point types.
+    17/Oct/2026 - Added the buffered CSV writer.
+    17/Oct/2026 - Added the block reader.
+    17/Oct/2026 - Added the reader of the structure-of-arrays container.
+    17/Oct/2026 - Matched the statement style of the directory and dropped
+                  noexcept from the file writers.
+*/
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include "ch_io2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+MappedFile::MappedFile() noexcept
+    : pData_{ nullptr }, iSize_{ 0 }
+#ifdef _WIN32
+    , hFile_{ INVALID_HANDLE_VALUE }, hMapping_{ nullptr }
+#endif
+{
+}
+MappedFile::~MappedFile() {
+    close();
+}
+bool MappedFile::open(const string& filePath) noexcept {
+    close();
+#ifdef _WIN32
+    hFile_ = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(hFile_ == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER fileSize;
+    if(!GetFileSizeEx(hFile_, &fileSize)) {
+        close();
+        return false;
+    }
+    iSize_ = size_t(fileSize.QuadPart);
+    if(iSize_ == 0)
+        return true;
+    hMapping_ = CreateFileMappingA(hFile_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(!hMapping_) {
+        close();
+        return false;
+    }
+    pData_ = static_cast<const char*>(MapViewOfFile(hMapping_, FILE_MAP_READ, 0, 0, 0));
+    if(!pData_) {
+        close();
+        return false;
+    }
+#else
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) != 0) {
+        ::close(fd);
+        return false;
+    }
+    iSize_ = size_t(fileStat.st_size);
+    if(iSize_ > 0) {
+        void* pMapping = mmap(nullptr, iSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(pMapping == MAP_FAILED) {
+            ::close(fd);
+            iSize_ = 0;
+            return false;
+        }
+        madvise(pMapping, iSize_, MADV_SEQUENTIAL);
+        pData_ = static_cast<const char*>(pMapping);
+    }
+    // The mapping stays valid after the descriptor has been closed.
+    ::close(fd);
+#endif
+    return true;
+}
+void MappedFile::close() noexcept {
+#ifdef _WIN32
+    if(pData_)
+        UnmapViewOfFile(pData_);
+    if(hMapping_)
+        CloseHandle(hMapping_);
+    if(hFile_ != INVALID_HANDLE_VALUE)
+        CloseHandle(hFile_);
+    hMapping_ = nullptr;
+    hFile_ = INVALID_HANDLE_VALUE;
+#else
+    if(pData_)
+        munmap(const_cast<char*>(pData_), iSize_);
+#endif
+    pData_ = nullptr;
+    iSize_ = 0;
+}
+const char* MappedFile::data() const noexcept {
+    return pData_;
+}
+size_t MappedFile::size() const noexcept {
+    return iSize_;
+}
+
+// Parses the lines of the [p, pEnd) range and passes the x and y values of
+// every point to the addPoint callable. The range is expected to start at the
+// beginning of a line.
+template <class AddPoint>
+static void parseRange(const char* p, const char* pEnd, AddPoint&& addPoint) noexcept {
+    double x;
+    double y;
+    while(p < pEnd) {
+        const char* pEOL = static_cast<const char*>(memchr(p, '\n', size_t(pEnd - p)));
+        if(!pEOL)
+            pEOL = pEnd;
+
+        const char* q = parseDouble(skipBlanks(p, pEOL), pEOL, x);
+        if(q) {
+            q = skipBlanks(q, pEOL);
+            if(q < pEOL && *q == ',') {
+                q = parseDouble(skipBlanks(q + 1, pEOL), pEOL, y);
+                if(q)
+                    addPoint(x, y);
+            }
+        }
+        p = pEOL + 1;
+    }
+}
+static void parseRange(const char* p, const char* pEnd, DataContainer& container) noexcept {
+    parseRange(p, pEnd, [&container](double x, double y) {
+        DataPoint2D point;
+        point.x = x;
+        point.y = y;
+        container.push_back(point);
+    });
+}
+
+// Copies the packed values that follow the binary header into the container.
+template <class V>
+static void copyPackedValues(const char* pValues, size_t nPoints, DataContainer& container) noexcept {
+    size_t inxFirst = container.size();
+    container.resize(inxFirst + nPoints);
+    DataPoint2D* pPoint = container.data() + inxFirst;
+    V xy[2];
+    for(size_t inx = 0; inx < nPoints; inx++, pValues += sizeof(xy)) {
+        memcpy(xy, pValues, sizeof(xy));
+        pPoint[inx].x = double(xy[0]);
+        pPoint[inx].y = double(xy[1]);
+    }
+}
+
+size_t dk::estimateLineCount(const char* pData, size_t iSize) noexcept {
+    const size_t sampleSize = min(iSize, size_t(1) << 16);
+    size_t nLines = size_t(count(pData, pData + sampleSize, '\n'));
+    if(nLines == 0)
+        return 1;
+    // Add a small margin so that the estimate is rarely short.
+    return size_t(double(iSize) / double(sampleSize) * double(nLines) * 1.02) + 1;
+}
+bool dk::isBinaryPointCloud(const char* pData, size_t iSize) noexcept {
+    BinaryHeader2D header;
+    if(iSize < sizeof(header) || memcmp(pData, header.magic, sizeof(header.magic)) != 0)
+        return false;
+    memcpy(&header, pData, sizeof(header));
+    if(header.iValueSize != sizeof(double) && header.iValueSize != sizeof(float))
+        return false;
+    return header.nPoints <= (iSize - sizeof(header)) / (2 * header.iValueSize);
+}
+
+bool dk::readInpFile(const string& inpFileName, DataContainer& container, size_t nThreads) {
+    MappedFile inpFile;
+    if(!inpFile.open(inpFileName))
+        return false;
+
+    const char* pData = inpFile.data();
+    size_t iSize = inpFile.size();
+    if(iSize == 0)
+        return true;
+
+    if(isBinaryPointCloud(pData, iSize)) {
+        BinaryHeader2D header;
+        memcpy(&header, pData, sizeof(header));
+        if(header.iValueSize == sizeof(double))
+            copyPackedValues<double>(pData + sizeof(header), size_t(header.nPoints), container);
+        else
+            copyPackedValues<float>(pData + sizeof(header), size_t(header.nPoints), container);
+        return true;
+    }
+
+    // Don't bother spawning threads for chunks that are too small to benefit.
+    const size_t minChunkSize {size_t(1) << 20};
+    nThreads = max(size_t(1), min(nThreads, iSize / minChunkSize));
+    if(nThreads == 1) {
+        container.reserve(container.size() + estimateLineCount(pData, iSize));
+        parseRange(pData, pData + iSize, container);
+        return true;
+    }
+
+    // Split the buffer into chunks aligned at line boundaries.
+    vector<const char*> boundaries(nThreads + 1);
+    boundaries[0] = pData;
+    boundaries[nThreads] = pData + iSize;
+    for(size_t inx = 1; inx < nThreads; inx++) {
+        const char* p = max(pData + inx * iSize / nThreads, boundaries[inx - 1]);
+        const char* pEOL = static_cast<const char*>(memchr(p, '\n', size_t(pData + iSize - p)));
+        boundaries[inx] = pEOL ? pEOL + 1 : pData + iSize;
+    }
+
+    vector<DataContainer> chunks(nThreads);
+    auto parseChunk = [&](size_t inxChunk) {
+        const char* p = boundaries[inxChunk];
+        const char* pEnd = boundaries[inxChunk + 1];
+        chunks[inxChunk].reserve(estimateLineCount(p, size_t(pEnd - p)));
+        parseRange(p, pEnd, chunks[inxChunk]);
+    };
+
+    // The calling thread processes the first chunk itself.
+    vector<thread> threads;
+    threads.reserve(nThreads - 1);
+    for(size_t inxChunk = 1; inxChunk < nThreads; inxChunk++)
+        threads.emplace_back(parseChunk, inxChunk);
+    parseChunk(0);
+    for(auto& thr : threads)
+        thr.join();
+
+    size_t nPoints = container.size();
+    for(const auto& chunk : chunks)
+        nPoints += chunk.size();
+    container.reserve(nPoints);
+    for(const auto& chunk : chunks)
+        container.insert(container.end(), chunk.begin(), chunk.end());
+    return true;
+}
+bool dk::readGroupedInpFile(const string& inpFileName, PointGroups2D& pointGroups) {
+    MappedFile inpFile;
+    if(!inpFile.open(inpFileName))
+        return false;
+
+    pointGroups.keys.clear();
+    pointGroups.groups.clear();
+
+    // The keys are hashed as views into the mapped file, so a string is only
+    // created when a new group is encountered.
+    unordered_map<string_view, size_t> groupIndex;
+
+    const char* p = inpFile.data();
+    const char* pEnd = p + inpFile.size();
+    DataPoint2D point;
+    while(p < pEnd) {
+        const char* pEOL = static_cast<const char*>(memchr(p, '\n', size_t(pEnd - p)));
+        if(!pEOL)
+            pEOL = pEnd;
+
+        const char* pKey = skipBlanks(p, pEOL);
+        const char* pComma = static_cast<const char*>(memchr(pKey, ',', size_t(pEOL - pKey)));
+        p = pEOL + 1;
+        if(!pComma)
+            continue;
+        const char* pKeyEnd = pComma;
+        while(pKeyEnd > pKey && (pKeyEnd[-1] == ' ' || pKeyEnd[-1] == '\t'))
+            pKeyEnd--;
+
+        const char* q = parseDouble(skipBlanks(pComma + 1, pEOL), pEOL, point.x);
+        if(!q)
+            continue;
+        q = skipBlanks(q, pEOL);
+        if(q == pEOL || *q != ',')
+            continue;
+        if(!parseDouble(skipBlanks(q + 1, pEOL), pEOL, point.y))
+            continue;
+
+        string_view key(pKey, size_t(pKeyEnd - pKey));
+        auto it = groupIndex.find(key);
+        if(it == groupIndex.end()) {
+            pointGroups.keys.emplace_back(key);
+            pointGroups.groups.emplace_back();
+            it = groupIndex.emplace(key, pointGroups.groups.size() - 1).first;
+        }
+        pointGroups.groups[it->second].push_back(point);
+    }
+    return true;
+}
+template <class T>
+bool dk::readInpFile(const string& inpFileName, BasicDataContainer2D<T>& container,
+        double scale, size_t& nRejected) {
+    nRejected = 0;
+    MappedFile inpFile;
+    if(!inpFile.open(inpFileName))
+        return false;
+
+    const char* pData = inpFile.data();
+    size_t iSize = inpFile.size();
+    if(iSize == 0)
+        return true;
+
+    auto addPoint = [&container, scale, &nRejected](double x, double y) {
+        BasicDataPoint2D<T> point;
+        if(CoordinateTraits<T>::fromDouble(x, scale, point.x) && CoordinateTraits<T>::fromDouble(y, scale, point.y))
+            container.push_back(point);
+        else
+            nRejected++;
+    };
+
+    if(isBinaryPointCloud(pData, iSize)) {
+        BinaryHeader2D header;
+        memcpy(&header, pData, sizeof(header));
+        container.reserve(container.size() + size_t(header.nPoints));
+        const char* pValues = pData + sizeof(header);
+        for(size_t inx = 0; inx < size_t(header.nPoints); inx++) {
+            if(header.iValueSize == sizeof(double)) {
+                double xy[2];
+                memcpy(xy, pValues + inx * sizeof(xy), sizeof(xy));
+                addPoint(xy[0], xy[1]);
+            }
+            else {
+                float xy[2];
+                memcpy(xy, pValues + inx * sizeof(xy), sizeof(xy));
+                addPoint(double(xy[0]), double(xy[1]));
+            }
+        }
+        return true;
+    }
+
+    container.reserve(container.size() + estimateLineCount(pData, iSize));
+    parseRange(pData, pData + iSize, addPoint);
+    return true;
+}
+template bool dk::readInpFile<double>(const string&, BasicDataContainer2D<double>&, double, size_t&);
+template bool dk::readInpFile<float>(const string&, BasicDataContainer2D<float>&, double, size_t&);
+template bool dk::readInpFile<int32_t>(const string&, BasicDataContainer2D<int32_t>&, double, size_t&);
+bool dk::readInpFile(const string& inpFileName, DataContainerSoA2D& container) {
+    MappedFile inpFile;
+    if(!inpFile.open(inpFileName))
+        return false;
+
+    const char* pData = inpFile.data();
+    size_t iSize = inpFile.size();
+    if(iSize == 0)
+        return true;
+
+    auto addPoint = [&container](double x, double y) {
+        container.x.push_back(x);
+        container.y.push_back(y);
+    };
+
+    if(isBinaryPointCloud(pData, iSize)) {
+        BinaryHeader2D header;
+        memcpy(&header, pData, sizeof(header));
+        container.x.reserve(container.x.size() + size_t(header.nPoints));
+        container.y.reserve(container.y.size() + size_t(header.nPoints));
+        const char* pValues = pData + sizeof(header);
+        for(size_t inx = 0; inx < size_t(header.nPoints); inx++) {
+            if(header.iValueSize == sizeof(double)) {
+                double xy[2];
+                memcpy(xy, pValues + inx * sizeof(xy), sizeof(xy));
+                addPoint(xy[0], xy[1]);
+            }
+            else {
+                float xy[2];
+                memcpy(xy, pValues + inx * sizeof(xy), sizeof(xy));
+                addPoint(double(xy[0]), double(xy[1]));
+            }
+        }
+        return true;
+    }
+
+    size_t nLines = estimateLineCount(pData, iSize);
+    container.x.reserve(container.x.size() + nLines);
+    container.y.reserve(container.y.size() + nLines);
+    parseRange(pData, pData + iSize, addPoint);
+    return true;
+}
+
+// Reads the blocks of a file on a background thread into two buffers, so
+// the next block is being read while the current one is processed.
+class BlockPrefetcher {
+public:
+    // Reads up to iByteCount bytes of the stream in blocks of iBlockSize
+    // bytes starting from the current position.
+    BlockPrefetcher(istream& inpStream, size_t iBlockSize, uint64_t iByteCount)
+        : inpStream_(inpStream), iByteCount_{ iByteCount }, bStop_{ false }, bFailed_{ false }
+    {
+        for(auto& buffer : buffers_) {
+            buffer.data.resize(iBlockSize);
+            buffer.iSize = 0;
+            buffer.bFull = false;
+        }
+        reader_ = thread(&BlockPrefetcher::readBlocks, this);
+    }
+    ~BlockPrefetcher() {
+        {
+            lock_guard<mutex> lock(mutex_);
+            bStop_ = true;
+        }
+        condition_.notify_all();
+        reader_.join();
+    }
+    BlockPrefetcher(const BlockPrefetcher&) = delete;
+    BlockPrefetcher& operator = (const BlockPrefetcher&) = delete;
+
+    // Waits for the next block and returns its size, which is 0 at the end
+    // of the data. The block stays valid until the next call.
+    size_t nextBlock(const char*& pData) {
+        unique_lock<mutex> lock(mutex_);
+        if(iBlockCount_ > 0) {
+            // Hand the previous buffer back to the reader.
+            buffers_[(iBlockCount_ - 1) % 2].bFull = false;
+            condition_.notify_all();
+        }
+        Buffer& buffer = buffers_[iBlockCount_ % 2];
+        condition_.wait(lock, [&buffer]() { return buffer.bFull; });
+        iBlockCount_++;
+        pData = buffer.data.data();
+        return buffer.iSize;
+    }
+    bool failed() const noexcept {
+        return bFailed_;
+    }
+
+private:
+    struct Buffer {
+        vector<char> data;
+        size_t iSize;
+        bool bFull;
+    };
+
+    void readBlocks() {
+        for(size_t inxBlock = 0; ; inxBlock++) {
+            Buffer& buffer = buffers_[inxBlock % 2];
+            {
+                unique_lock<mutex> lock(mutex_);
+                condition_.wait(lock, [this, &buffer]() { return bStop_ || !buffer.bFull; });
+                if(bStop_)
+                    return;
+            }
+            size_t iSize = size_t(min(uint64_t(buffer.data.size()), iByteCount_));
+            inpStream_.read(buffer.data.data(), streamsize(iSize));
+            iSize = size_t(inpStream_.gcount());
+            iByteCount_ -= iSize;
+            {
+                lock_guard<mutex> lock(mutex_);
+                bFailed_ = bFailed_ || inpStream_.bad();
+                buffer.iSize = iSize;
+                buffer.bFull = true;
+            }
+            condition_.notify_all();
+            if(iSize == 0)
+                return;
+        }
+    }
+
+    istream& inpStream_;
+    uint64_t iByteCount_;
+    Buffer buffers_[2];
+    size_t iBlockCount_ {0};
+    bool bStop_;
+    bool bFailed_;
+    mutex mutex_;
+    condition_variable condition_;
+    thread reader_;
+};
+
+bool dk::readInpFileBlocks(const string& inpFileName, size_t iBlockSize, const BlockSink2D& sink) {
+    ifstream inpFile(inpFileName, ios::binary | ios::ate);
+    if(!inpFile)
+        return false;
+    uint64_t iFileSize = uint64_t(inpFile.tellg());
+    inpFile.seekg(0);
+
+    BinaryHeader2D header;
+    bool bBinary {false};
+    if(iFileSize >= sizeof(header)) {
+        char headerData[sizeof(header)];
+        inpFile.read(headerData, sizeof(headerData));
+        bBinary = isBinaryPointCloud(headerData, size_t(min(iFileSize, uint64_t(SIZE_MAX))));
+        if(bBinary)
+            memcpy(&header, headerData, sizeof(header));
+        else
+            inpFile.seekg(0);
+    }
+
+    DataContainer blockStore;
+    if(bBinary) {
+        // The blocks hold whole points.
+        size_t iPointSize = 2 * header.iValueSize;
+        iBlockSize = max(iBlockSize / iPointSize, size_t(1)) * iPointSize;
+        blockStore.reserve(iBlockSize / iPointSize);
+        BlockPrefetcher prefetcher(inpFile, iBlockSize, header.nPoints * iPointSize);
+        const char* pData;
+        for(size_t iSize = prefetcher.nextBlock(pData); iSize > 0; iSize = prefetcher.nextBlock(pData)) {
+            blockStore.clear();
+            if(header.iValueSize == sizeof(double))
+                copyPackedValues<double>(pData, iSize / iPointSize, blockStore);
+            else
+                copyPackedValues<float>(pData, iSize / iPointSize, blockStore);
+            sink(blockStore);
+        }
+        return !prefetcher.failed();
+    }
+
+    // The shortest line that holds a point is three characters long plus
+    // the line feed. The tail of a block that doesn't end with a line feed
+    // is carried over to the next block.
+    blockStore.reserve(iBlockSize / 4 + 2);
+    string carry;
+    BlockPrefetcher prefetcher(inpFile, iBlockSize, iFileSize);
+    const char* pData;
+    for(size_t iSize = prefetcher.nextBlock(pData); iSize > 0; iSize = prefetcher.nextBlock(pData)) {
+        const char* p = pData;
+        const char* pEnd = pData + iSize;
+        blockStore.clear();
+        if(carry.size() > 0) {
+            const char* pEOL = static_cast<const char*>(memchr(p, '\n', iSize));
+            carry.append(p, pEOL ? pEOL : pEnd);
+            if(!pEOL)
+                continue;
+            parseRange(carry.data(), carry.data() + carry.size(), blockStore);
+            carry.clear();
+            p = pEOL + 1;
+        }
+        const char* pLast = pEnd;
+        while(pLast > p && pLast[-1] != '\n')
+            pLast--;
+        parseRange(p, pLast, blockStore);
+        carry.assign(pLast, pEnd);
+        sink(blockStore);
+    }
+    if(carry.size() > 0) {
+        blockStore.clear();
+        parseRange(carry.data(), carry.data() + carry.size(), blockStore);
+        sink(blockStore);
+    }
+    return !prefetcher.failed();
+}
+size_t dk::readCSVChunk(istream& inpStream, DataContainer& container, size_t maxPoints) {
+    // The line buffer is reused across calls to avoid per line allocations.
+    static thread_local string inpLine;
+    size_t iInitialSize = container.size();
+    while(container.size() - iInitialSize < maxPoints && getline(inpStream, inpLine))
+        parseRange(inpLine.data(), inpLine.data() + inpLine.size(), container);
+    return container.size() - iInitialSize;
+}
+bool dk::writeBinFile(const string& outFileName, const DataContainer& container,
+        bool bSinglePrecision) {
+    ofstream outFile(outFileName, ios::binary);
+    if(!outFile)
+        return false;
+
+    BinaryHeader2D header;
+    header.iValueSize = bSinglePrecision ? sizeof(float) : sizeof(double);
+    header.nPoints = container.size();
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // Pack the values in blocks to keep the number of write calls low.
+    const size_t blockSize {8192};
+    vector<double> doubleBlock;
+    vector<float> floatBlock;
+    for(size_t inxFirst = 0; inxFirst < container.size(); inxFirst += blockSize) {
+        size_t inxLast = min(container.size(), inxFirst + blockSize);
+        if(bSinglePrecision) {
+            floatBlock.clear();
+            for(size_t inx = inxFirst; inx < inxLast; inx++) {
+                floatBlock.push_back(float(container[inx].x));
+                floatBlock.push_back(float(container[inx].y));
+            }
+            outFile.write(reinterpret_cast<const char*>(floatBlock.data()), floatBlock.size() * sizeof(float));
+        }
+        else {
+            doubleBlock.clear();
+            for(size_t inx = inxFirst; inx < inxLast; inx++) {
+                doubleBlock.push_back(container[inx].x);
+                doubleBlock.push_back(container[inx].y);
+            }
+            outFile.write(reinterpret_cast<const char*>(doubleBlock.data()), doubleBlock.size() * sizeof(double));
+        }
+    }
+    return bool(outFile);
+}
+CSVWriter2D::CSVWriter2D(ostream& outStream, int precision)
+    : outStream_{ outStream }, iPrecision_{ precision }, buffer_(size_t(1) << 20), iSize_{ 0 }
+{
+}
+CSVWriter2D::~CSVWriter2D() {
+    flush();
+}
+void CSVWriter2D::makeRoom_(size_t nChars) {
+    if(buffer_.size() - iSize_ < nChars)
+        flush();
+    if(buffer_.size() < nChars)
+        buffer_.resize(nChars);
+}
+void CSVWriter2D::writeValue_(double value) noexcept {
+    // The buffer has room for the longest representation of a double.
+    auto result = to_chars(buffer_.data() + iSize_, buffer_.data() + buffer_.size(), value,
+        chars_format::general, iPrecision_);
+    iSize_ = size_t(result.ptr - buffer_.data());
+}
+void CSVWriter2D::write(double x, double y) {
+    // A value in the %g format takes up to 24 characters with 17 digits.
+    const size_t maxValueSize {32};
+    makeRoom_(2 * maxValueSize + 2);
+    writeValue_(x);
+    buffer_[iSize_++] = ',';
+    writeValue_(y);
+    buffer_[iSize_++] = '\n';
+}
+void CSVWriter2D::write(string_view key, double x, double y) {
+    makeRoom_(key.size() + 1);
+    memcpy(buffer_.data() + iSize_, key.data(), key.size());
+    iSize_ += key.size();
+    buffer_[iSize_++] = ',';
+    write(x, y);
+}
+void CSVWriter2D::write(size_t index) {
+    const size_t maxIndexSize {24};
+    makeRoom_(maxIndexSize);
+    auto result = to_chars(buffer_.data() + iSize_, buffer_.data() + buffer_.size(), index);
+    iSize_ = size_t(result.ptr - buffer_.data());
+    buffer_[iSize_++] = '\n';
+}
+bool CSVWriter2D::flush() {
+    if(iSize_ > 0)
+        outStream_.write(buffer_.data(), streamsize(iSize_));
+    iSize_ = 0;
+    return bool(outStream_);
+}
+
+bool dk::writeCSVFile(const string& outFileName, const DataContainer& container, int precision) {
+    ofstream outFile(outFileName);
+    if(!outFile)
+        return false;
+    CSVWriter2D writer(outFile, precision);
+    for(const auto& point : container)
+        writer.write(point.x, point.y);
+    return writer.flush();
+}
@@ -0,0 +1,235 @@
+/* ch_io2d.hpp
+This module declares the input/output facilities of the 2D Convex Hull
+application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Added the binary point cloud format.
+    17/Oct/2026 - Added the chunked stream reader.
+    17/Oct/2026 - Added the grouped input file reader.
+    17/Oct/2026 - Shared the parsing helpers with the 3D reader.
+    17/Oct/2026 - Added the reader of the compact point types.
+    17/Oct/2026 - Added the buffered CSV writer.
+    17/Oct/2026 - Added the block reader.
+    17/Oct/2026 - Added the reader of the structure-of-arrays container.
+    17/Oct/2026 - Matched the statement style of the directory and dropped
+                  noexcept from the file writers.
+*/
+
+#ifndef ch_io2d_hpp
+#define ch_io2d_hpp
+
+#include <charconv>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ch_alg2d.hpp"
+#include "ch_batch2d.hpp"
+#include "ch_prec2d.hpp"
+#include "ch_soa2d.hpp"
+
+namespace dk {
+
+    // The MappedFile class provides read-only access to the content of a
+    // file mapped into memory. The mapping is released by the destructor.
+    class MappedFile {
+    public:
+        MappedFile() noexcept;
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator = (const MappedFile&) = delete;
+
+        // Maps the whole file into memory. Returns false if the file can't be
+        // opened or mapped. An empty file is mapped successfully and yields
+        // a zero size.
+        bool open(const std::string& filePath) noexcept;
+        void close() noexcept;
+
+        const char* data() const noexcept;
+        size_t size() const noexcept;
+
+    private:
+        const char* pData_;
+        size_t iSize_;
+#ifdef _WIN32
+        void* hFile_;
+        void* hMapping_;
+#endif
+    };
+
+    // Helpers of the CSV parsers. skipBlanks skips spaces, tabs and carriage
+    // returns. parseDouble parses a value at p and returns a pointer past it
+    // or nullptr if there is no valid value at p.
+    inline const char* skipBlanks(const char* p, const char* pEnd) noexcept {
+        while(p < pEnd && (*p == ' ' || *p == '\t' || *p == '\r'))
+            p++;
+        return p;
+    }
+    inline const char* parseDouble(const char* p, const char* pEnd, double& value) noexcept {
+        // std::from_chars doesn't accept an explicit plus sign.
+        if(p < pEnd && *p == '+')
+            p++;
+        auto result = std::from_chars(p, pEnd, value);
+        if(result.ec != std::errc())
+            return nullptr;
+        return result.ptr;
+    }
+
+    // Estimates the number of lines in the buffer by counting line feeds in
+    // a sample taken at the start of the buffer.
+    size_t estimateLineCount(const char* pData, size_t iSize) noexcept;
+
+    // The binary point cloud format consists of the header below followed by
+    // nPoints pairs of packed x and y values. The values are either doubles
+    // or floats as specified by iValueSize. All fields are stored in the
+    // native (little-endian on all supported platforms) byte order. The
+    // header is 16 bytes long so the values that follow it are naturally
+    // aligned when the file is mapped into memory.
+    struct BinaryHeader2D {
+        char magic[4] {'C', 'H', '2', 'D'};
+        uint32_t iValueSize {sizeof(double)};
+        uint64_t nPoints {0};
+    };
+
+    // Checks whether the buffer starts with a valid binary header that is
+    // consistent with the buffer size.
+    bool isBinaryPointCloud(const char* pData, size_t iSize) noexcept;
+
+    // Reads a CSV file containing comma separated x and y values, one point
+    // per line, and appends the points to the container.
+    //
+    // The file is mapped into memory and the values are parsed in place
+    // using std::from_chars, so there are no per line allocations. The
+    // container is reserved up front using an estimate of the line count
+    // derived from a sample at the start of the file. If nThreads is greater
+    // than 1 then the file is split into chunks at line boundaries and the
+    // chunks are parsed on separate threads.
+    //
+    // Lines that don't start with a pair of numeric values are skipped.
+    //
+    // If the file starts with a binary header (see BinaryHeader2D) then it is
+    // treated as a binary point cloud and the packed values are copied into
+    // the container without any parsing.
+    //
+    // Returns false if the file can't be read.
+    bool readInpFile(const std::string& inpFileName, DataContainer& container, size_t nThreads = 1);
+
+    // Reads the input file like readInpFile does but converts the values to
+    // a compact coordinate type as they are parsed, so the memory footprint
+    // of the dataset is that of the compact type. See CoordinateTraits for
+    // the meaning of the scale. Points with values that can't be represented
+    // by the coordinate type are skipped and counted in nRejected. Available
+    // for double, float and int32_t coordinates. With double coordinates
+    // the points take 16 bytes each rather than the 24 bytes of DataPoint2D
+    // and none of them is rejected.
+    //
+    // Returns false if the file can't be read.
+    template <class T>
+    bool readInpFile(const std::string& inpFileName, BasicDataContainer2D<T>& container,
+        double scale, size_t& nRejected);
+
+    // Reads the input file like readInpFile does but appends the x and y
+    // values straight to the arrays of the structure-of-arrays container,
+    // so the dataset is never held as DataPoint2D values. The file is parsed
+    // on the calling thread.
+    //
+    // Returns false if the file can't be read.
+    bool readInpFile(const std::string& inpFileName, DataContainerSoA2D& container);
+
+    // Reads a CSV file containing a group key followed by comma separated x
+    // and y values, one point per line, and distributes the points among the
+    // groups by key. The key is the text that precedes the first comma with
+    // the surrounding blanks removed. Lines that don't contain a key followed
+    // by a pair of numeric values are skipped. The previous content of
+    // pointGroups is discarded.
+    //
+    // Returns false if the file can't be read.
+    bool readGroupedInpFile(const std::string& inpFileName, PointGroups2D& pointGroups);
+
+    // Receives the points of a block of the input file. The container may
+    // be modified; it is cleared before the next block is parsed into it.
+    typedef std::function<void(DataContainer& blockStore)> BlockSink2D;
+
+    // Reads the input file, either CSV or a binary point cloud, in blocks of
+    // iBlockSize bytes and passes the points of every block to the sink.
+    // Unlike readInpFile the file is read rather than mapped into memory, so
+    // the memory footprint is that of two block buffers and of the points of
+    // one block regardless of the size of the file. The container of the
+    // points is reserved once for the largest number of points a block can
+    // hold. A background thread reads the next block while the sink
+    // processes the current one.
+    //
+    // Lines that don't start with a pair of numeric values are skipped. A
+    // line that spans two blocks is parsed with the second one.
+    //
+    // Returns false if the file can't be read.
+    bool readInpFileBlocks(const std::string& inpFileName, size_t iBlockSize, const BlockSink2D& sink);
+
+    // Reads up to maxPoints points from a stream of CSV lines and appends
+    // them to the container. Lines that don't start with a pair of numeric
+    // values are skipped. Returns the number of points appended, which is
+    // less than maxPoints only if the end of the stream has been reached.
+    size_t readCSVChunk(std::istream& inpStream, DataContainer& container, size_t maxPoints);
+
+    // Writes the x and y values of the points to a binary point cloud file.
+    // Set bSinglePrecision to true to store the values as floats.
+    // Returns false if the file can't be written.
+    bool writeBinFile(const std::string& outFileName, const DataContainer& container,
+        bool bSinglePrecision = false);
+
+    // The CSVWriter2D class formats the output values with std::to_chars
+    // into a large buffer and writes the buffer to the stream in big blocks,
+    // bypassing the locale aware formatting of the stream operators. The
+    // values are formatted like printf %g does, with the specified number
+    // of significant digits in the [1, 17] range. The default of 6 digits
+    // delivers the same text as the stream operators with the default
+    // settings, while 17 digits reproduce the values exactly.
+    //
+    // The buffered text is written to the stream by flush and by the
+    // destructor. Flush the writer before writing anything to the stream
+    // directly.
+    class CSVWriter2D {
+    public:
+        static const int defaultPrecision {6};
+        static const int maxPrecision {17};
+
+        CSVWriter2D(std::ostream& outStream, int precision = defaultPrecision);
+        ~CSVWriter2D();
+        CSVWriter2D(const CSVWriter2D&) = delete;
+        CSVWriter2D& operator = (const CSVWriter2D&) = delete;
+
+        // Writes a line containing comma separated x and y values.
+        void write(double x, double y);
+        // Writes a line containing a key followed by x and y values.
+        void write(std::string_view key, double x, double y);
+        // Writes a line containing an index.
+        void write(size_t index);
+
+        // Returns false if the stream has failed.
+        bool flush();
+
+    private:
+        void makeRoom_(size_t nChars);
+        void writeValue_(double value) noexcept;
+
+        std::ostream& outStream_;
+        int iPrecision_;
+        std::vector<char> buffer_;
+        size_t iSize_;
+    };
+
+    // Writes the points to a CSV file, one comma separated x and y pair per
+    // line, with the specified number of significant digits (see
+    // CSVWriter2D). Returns false if the file can't be written.
+    bool writeCSVFile(const std::string& outFileName, const DataContainer& container,
+        int precision = CSVWriter2D::defaultPrecision);
+
+};   // namespace dk
+
+#endif // ch_io2d_hpp
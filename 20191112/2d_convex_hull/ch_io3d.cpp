@@ -0,0 +1,137 @@
+/* ch_io3d.cpp
+This module implements the input/output facilities of the 3D Convex Hull
+application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Write the values with enough digits to round-trip.
+    17/Oct/2026 - Matched the statement style of the directory and dropped
+                  noexcept from the file writers.
+*/
+
+#include <cstring>
+#include <fstream>
+#include "ch_io2d.hpp"
+#include "ch_io3d.hpp"
+
+using namespace std;
+using namespace dk;
+
+// Parses the lines of the [p, pEnd) range and appends the points to the
+// container.
+static void parseRange3D(const char* p, const char* pEnd, DataContainer3D& container) noexcept {
+    DataPoint3D point;
+    while(p < pEnd) {
+        const char* pEOL = static_cast<const char*>(memchr(p, '\n', size_t(pEnd - p)));
+        if(!pEOL)
+            pEOL = pEnd;
+
+        const char* q = parseDouble(skipBlanks(p, pEOL), pEOL, point.x);
+        for(double* pValue : {&point.y, &point.z}) {
+            if(!q)
+                break;
+            q = skipBlanks(q, pEOL);
+            q = (q < pEOL && *q == ',') ? parseDouble(skipBlanks(q + 1, pEOL), pEOL, *pValue) : nullptr;
+        }
+        if(q)
+            container.push_back(point);
+        p = pEOL + 1;
+    }
+}
+
+// Copies the packed values that follow the binary header into the container.
+template <class V>
+static void copyPackedValues3D(const char* pValues, size_t nPoints, DataContainer3D& container) noexcept {
+    size_t inxFirst = container.size();
+    container.resize(inxFirst + nPoints);
+    DataPoint3D* pPoint = container.data() + inxFirst;
+    V xyz[3];
+    for(size_t inx = 0; inx < nPoints; inx++, pValues += sizeof(xyz)) {
+        memcpy(xyz, pValues, sizeof(xyz));
+        pPoint[inx] = DataPoint3D{double(xyz[0]), double(xyz[1]), double(xyz[2])};
+    }
+}
+
+bool dk::isBinaryPointCloud3D(const char* pData, size_t iSize) noexcept {
+    BinaryHeader3D header;
+    if(iSize < sizeof(header) || memcmp(pData, header.magic, sizeof(header.magic)) != 0)
+        return false;
+    memcpy(&header, pData, sizeof(header));
+    if(header.iValueSize != sizeof(double) && header.iValueSize != sizeof(float))
+        return false;
+    return header.nPoints <= (iSize - sizeof(header)) / (3 * header.iValueSize);
+}
+bool dk::readInpFile3D(const string& inpFileName, DataContainer3D& container) {
+    MappedFile inpFile;
+    if(!inpFile.open(inpFileName))
+        return false;
+
+    const char* pData = inpFile.data();
+    size_t iSize = inpFile.size();
+    if(iSize == 0)
+        return true;
+
+    if(isBinaryPointCloud3D(pData, iSize)) {
+        BinaryHeader3D header;
+        memcpy(&header, pData, sizeof(header));
+        if(header.iValueSize == sizeof(double))
+            copyPackedValues3D<double>(pData + sizeof(header), size_t(header.nPoints), container);
+        else
+            copyPackedValues3D<float>(pData + sizeof(header), size_t(header.nPoints), container);
+        return true;
+    }
+
+    container.reserve(container.size() + estimateLineCount(pData, iSize));
+    parseRange3D(pData, pData + iSize, container);
+    return true;
+}
+bool dk::writeBinFile3D(const string& outFileName, const DataContainer3D& container,
+        bool bSinglePrecision) {
+    ofstream outFile(outFileName, ios::binary);
+    if(!outFile)
+        return false;
+
+    BinaryHeader3D header;
+    header.iValueSize = bSinglePrecision ? sizeof(float) : sizeof(double);
+    header.nPoints = container.size();
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for(const auto& point : container) {
+        if(bSinglePrecision) {
+            const float xyz[3] {float(point.x), float(point.y), float(point.z)};
+            outFile.write(reinterpret_cast<const char*>(xyz), sizeof(xyz));
+        }
+        else {
+            const double xyz[3] {point.x, point.y, point.z};
+            outFile.write(reinterpret_cast<const char*>(xyz), sizeof(xyz));
+        }
+    }
+    return bool(outFile);
+}
+bool dk::writeCSVFile3D(const string& outFileName, const DataContainer3D& container) {
+    ofstream outFile(outFileName);
+    if(!outFile)
+        return false;
+    outFile.precision(CSVWriter2D::maxPrecision);
+    for(const auto& point : container)
+        outFile << point.x << "," << point.y << "," << point.z << '\n';
+    return bool(outFile);
+}
+void dk::writeObj(ostream& outStream, const TriangleMesh3D& mesh) {
+    // The stream may belong to the caller, so restore its precision.
+    streamsize oldPrecision = outStream.precision(CSVWriter2D::maxPrecision);
+    for(const auto& vertex : mesh.vertices)
+        outStream << "v " << vertex.x << " " << vertex.y << " " << vertex.z << '\n';
+    for(const auto& face : mesh.faces)
+        outStream << "f " << face[0] + 1 << " " << face[1] + 1 << " " << face[2] + 1 << '\n';
+    outStream.precision(oldPrecision);
+}
+bool dk::writeObjFile(const string& outFileName, const TriangleMesh3D& mesh) {
+    ofstream outFile(outFileName);
+    if(!outFile)
+        return false;
+    writeObj(outFile, mesh);
+    return bool(outFile);
+}
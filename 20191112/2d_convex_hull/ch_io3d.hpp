@@ -0,0 +1,67 @@
+/* ch_io3d.hpp
+This module declares the input/output facilities of the 3D Convex Hull
+application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Write the values with enough digits to round-trip.
+    17/Oct/2026 - Matched the statement style of the directory and dropped
+                  noexcept from the file writers.
+*/
+
+#ifndef ch_io3d_hpp
+#define ch_io3d_hpp
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "ch_alg3d.hpp"
+
+namespace dk {
+
+    // The binary 3D point cloud format mirrors the 2D one (see
+    // BinaryHeader2D) except that the magic literal reads "CH3D" and every
+    // point consists of packed x, y and z values.
+    struct BinaryHeader3D {
+        char magic[4] {'C', 'H', '3', 'D'};
+        uint32_t iValueSize {sizeof(double)};
+        uint64_t nPoints {0};
+    };
+
+    // Checks whether the buffer starts with a valid 3D binary header that is
+    // consistent with the buffer size.
+    bool isBinaryPointCloud3D(const char* pData, size_t iSize) noexcept;
+
+    // Reads a CSV file containing comma separated x, y and z values, one
+    // point per line, and appends the points to the container. Works like
+    // readInpFile does: the file is mapped into memory and parsed in place,
+    // lines that don't start with three numeric values are skipped and 3D
+    // binary point cloud files are detected automatically.
+    //
+    // Returns false if the file can't be read.
+    bool readInpFile3D(const std::string& inpFileName, DataContainer3D& container);
+
+    // Writes the points to a 3D binary point cloud file. Set
+    // bSinglePrecision to true to store the values as floats.
+    // Returns false if the file can't be written.
+    bool writeBinFile3D(const std::string& outFileName, const DataContainer3D& container,
+        bool bSinglePrecision = false);
+
+    // Writes the points to a CSV file, one comma separated x, y and z triple
+    // per line. The values are written with 17 significant digits, so they
+    // are reproduced exactly when the file is read back. Returns false if
+    // the file can't be written.
+    bool writeCSVFile3D(const std::string& outFileName, const DataContainer3D& container);
+
+    // Writes the mesh in the Wavefront OBJ format: a "v x y z" line per
+    // vertex followed by an "f i j k" line per face. The vertex indices of
+    // the faces are 1-based as the format requires. The coordinates are
+    // written with 17 significant digits.
+    void writeObj(std::ostream& outStream, const TriangleMesh3D& mesh);
+    bool writeObjFile(const std::string& outFileName, const TriangleMesh3D& mesh);
+
+};   // namespace dk
+
+#endif // ch_io3d_hpp
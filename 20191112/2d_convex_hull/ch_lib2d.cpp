@@ -0,0 +1,147 @@
+/* ch_lib2d.cpp
+This module implements the interface of the libch2d shared library.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Fixed the size of the stack in the keep-collinear mode.
+    17/Oct/2026 - Report the number of culled points.
+    17/Oct/2026 - Skip the duplicate points in both modes.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include "ch_lib2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+typedef BasicDataPoint2D<double> Point;
+
+// The candidate points are copied into the scratch arena along with their
+// indices, so the sort works on contiguous memory rather than chasing the
+// indices around the input array.
+struct IndexedPoint2D {
+    double x;
+    double y;
+    size_t index;
+};
+
+// The scratch arena holds the candidate points followed by the stack of the
+// line loop under construction.
+static IndexedPoint2D* alignScratch(void* scratch) noexcept {
+    uintptr_t address = reinterpret_cast<uintptr_t>(scratch);
+    uintptr_t alignment = alignof(IndexedPoint2D);
+    return reinterpret_cast<IndexedPoint2D*>((address + alignment - 1) / alignment * alignment);
+}
+
+static double calcOrientation(const IndexedPoint2D& origin, const IndexedPoint2D& a,
+        const IndexedPoint2D& b) noexcept {
+    return calcOrientation2D(origin.x, origin.y, a.x, a.y, b.x, b.y);
+}
+
+// Same as buildHull2D_mc, but builds the line loop in the stack provided by
+// the caller and skips the duplicate points in both modes, so every point of
+// the loop appears once with the lowest index of its duplicates. The stack receives the positions of the vertices in the
+// [first, last) range and must have room for 2 * (last - first) entries:
+// in the keep-collinear mode the upper chain pushes the collinear points of
+// the bottom edge once more and only pops them when a higher point arrives.
+// Returns the size of the loop, which never exceeds (last - first + 1).
+static size_t buildIndexHull2D_mc(IndexedPoint2D* first, IndexedPoint2D* last,
+        size_t* stack, bool bKeepCollinear) noexcept {
+    // The indices break the ties, so the result doesn't depend on the sort.
+    sort(first, last, [](const IndexedPoint2D& p1, const IndexedPoint2D& p2) {
+        if(p1.x != p2.x)
+            return p1.x < p2.x;
+        if(p1.y != p2.y)
+            return p1.y < p2.y;
+        return p1.index < p2.index;
+    });
+
+    size_t nPoints = size_t(last - first);
+    auto isDuplicate = [first](size_t inx, size_t inxNeighbour) {
+        return first[inx].x == first[inxNeighbour].x && first[inx].y == first[inxNeighbour].y;
+    };
+    auto isRedundant = [first, stack, bKeepCollinear](size_t nStack, size_t inx) {
+        double crossProduct = calcOrientation(first[stack[nStack - 2]], first[stack[nStack - 1]], first[inx]);
+        return bKeepCollinear ? crossProduct < 0.0 : crossProduct <= 0.0;
+    };
+
+    // Lower chain.
+    size_t nStack {0};
+    size_t nDistinct {0};
+    for(size_t inx = 0; inx < nPoints; inx++) {
+        if(inx > 0 && isDuplicate(inx, inx - 1))
+            continue;
+        nDistinct++;
+        while(nStack >= 2 && isRedundant(nStack, inx))
+            nStack--;
+        stack[nStack++] = inx;
+    }
+
+    // All points coincide.
+    if(nStack == 1) {
+        stack[nStack++] = stack[0];
+        return nStack;
+    }
+
+    // If all points are collinear and retained then the upper chain would
+    // retrace the lower one, so close the loop straight away.
+    if(bKeepCollinear && nStack == nDistinct) {
+        const IndexedPoint2D& leftmost = first[stack[0]];
+        const IndexedPoint2D& rightmost = first[stack[nStack - 1]];
+        size_t inx {1};
+        while(inx < nStack - 1 && calcOrientation(leftmost, rightmost, first[stack[inx]]) == 0.0)
+            inx++;
+        if(inx >= nStack - 1) {
+            stack[nStack++] = stack[0];
+            return nStack;
+        }
+    }
+
+    // Upper chain. It starts to the left of the first of the rightmost
+    // duplicates and takes the first of every run of duplicates, the same
+    // ones as the lower chain.
+    size_t lowerChainSize = nStack + 1;
+    for(size_t inx = stack[nStack - 1]; inx-- > 0; ) {
+        if(inx > 0 && isDuplicate(inx, inx - 1))
+            continue;
+        while(nStack >= lowerChainSize && isRedundant(nStack, inx))
+            nStack--;
+        stack[nStack++] = inx;
+    }
+
+    return nStack;
+}
+
+size_t dk::getScratchSize2D(size_t nPoints) noexcept {
+    return nPoints * sizeof(IndexedPoint2D) + 2 * nPoints * sizeof(size_t)
+        + alignof(IndexedPoint2D) - 1;
+}
+
+size_t dk::calcConvexHull2D_indices(const BasicDataPoint2D<double>* points, size_t nPoints,
+        void* scratch, size_t scratchSize, size_t* hullIndices, size_t hullCapacity,
+        bool bCull, bool bKeepCollinear, size_t* pNumCulled) noexcept {
+    if(nPoints == 0 || scratch == nullptr || scratchSize < getScratchSize2D(nPoints))
+        return 0;
+
+    IndexedPoint2D* candidates = alignScratch(scratch);
+    size_t* stack = reinterpret_cast<size_t*>(candidates + nPoints);
+
+    // Only the points located outside the octagon of the extreme points can
+    // be vertices of the hull.
+    size_t nCandidates {0};
+    Point octagon[8];
+    size_t nVertices = bCull ? findOctagon2D(points, points + nPoints, octagon) : 0;
+    for(size_t inx = 0; inx < nPoints; inx++)
+        if(nVertices < 3 || !isInsideOctagon2D(octagon, nVertices, points[inx]))
+            candidates[nCandidates++] = {points[inx].x, points[inx].y, inx};
+    if(pNumCulled)
+        *pNumCulled = nPoints - nCandidates;
+
+    size_t nHull = buildIndexHull2D_mc(candidates, candidates + nCandidates, stack, bKeepCollinear);
+    for(size_t inx = 0; inx < min(nHull, hullCapacity); inx++)
+        hullIndices[inx] = candidates[stack[inx]].index;
+    return nHull;
+}
@@ -0,0 +1,77 @@
+/* ch_lib2d.hpp
+This module declares the interface of the libch2d shared library. The library
+calculates convex hulls in process without copying the input points and
+without allocating memory on the heap.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Allowed compiling the library into an executable on Windows.
+    17/Oct/2026 - Noted the sliding window hull.
+    17/Oct/2026 - Clarified the size of the line loop.
+    17/Oct/2026 - Report the number of culled points.
+    17/Oct/2026 - Reported the duplicate points once in both modes.
+*/
+
+#ifndef ch_lib2d_hpp
+#define ch_lib2d_hpp
+
+#include <cstddef>
+#include "ch_prec2d.hpp"
+
+// CMake defines ch2d_lib_EXPORTS when it builds the shared library. The
+// functions don't need to be declared with dllimport by the applications
+// linked to the library, so the sources can be compiled into an executable
+// directly as well.
+#if defined(_WIN32)
+    #if defined(ch2d_lib_EXPORTS)
+        #define CH2D_API __declspec(dllexport)
+    #else
+        #define CH2D_API
+    #endif
+#else
+    #define CH2D_API __attribute__((visibility("default")))
+#endif
+
+// The library also exports the sliding window hull declared in ch_win2d.hpp.
+
+namespace dk {
+
+    // Returns the size in bytes of the scratch arena required by
+    // calcConvexHull2D_indices for a dataset of nPoints points. The arena
+    // can be reused by subsequent calls on datasets of the same size or
+    // smaller ones.
+    CH2D_API size_t getScratchSize2D(size_t nPoints) noexcept;
+
+    // The calcConvexHull2D_indices function calculates the convex hull of
+    // nPoints points with Andrew's monotone chain algorithm. It neither
+    // modifies the points nor allocates any memory: the working data lives
+    // in the scratch arena provided by the caller (see getScratchSize2D),
+    // which needs no particular alignment.
+    //
+    // The result is a closed counter-clockwise line loop of indices into the
+    // points array written to hullIndices: the last index is a copy of the
+    // first one, the same as in the containers delivered by
+    // calcConvexHull2D_mc. Duplicate points are reported once, by the lowest
+    // of their indices, so a dataset of coincident points delivers a loop of
+    // two copies of one index.
+    // If bCull is true then the Akl-Toussaint culling stage is applied ahead
+    // of the sort, and the number of the points it discards is stored in
+    // *pNumCulled unless pNumCulled is null. If bKeepCollinear is true then the points located on the
+    // edges of the hull are retained as vertices. The orientation tests are
+    // exact (see ch_pred2d.hpp).
+    //
+    // Returns the number of indices in the line loop. If it exceeds
+    // hullCapacity then only the first hullCapacity indices are written, so
+    // the caller can retry with a bigger buffer. The line loop never holds
+    // more than nPoints + 1 indices, so a buffer of that size is always big
+    // enough for hullIndices. Returns 0 if nPoints is 0 or if the
+    // scratch arena is too small.
+    CH2D_API size_t calcConvexHull2D_indices(const BasicDataPoint2D<double>* points, size_t nPoints,
+        void* scratch, size_t scratchSize, size_t* hullIndices, size_t hullCapacity,
+        bool bCull = false, bool bKeepCollinear = false, size_t* pNumCulled = nullptr) noexcept;
+
+};   // namespace dk
+
+#endif // ch_lib2d_hpp
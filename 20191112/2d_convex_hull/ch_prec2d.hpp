@@ -0,0 +1,163 @@
+/* ch_prec2d.hpp
+This module declares the compact point types of the 2D Convex Hull
+application along with the hull functions templated on the point type.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Switched the double and float orientation tests to the
+                  robust predicate and added the collinear point option.
+    17/Oct/2026 - Split the octagon search out of cullRange2D.
+    17/Oct/2026 - Added the double precision coordinate traits.
+*/
+
+#ifndef ch_prec2d_hpp
+#define ch_prec2d_hpp
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "ch_data_point2d.hpp"
+#include "ch_pred2d.hpp"
+
+namespace dk {
+
+    // A point with coordinates of type T. Unlike DataPoint2D it doesn't carry
+    // an angle, so a BasicDataPoint2D<float> or a BasicDataPoint2D<int32_t>
+    // takes 8 bytes rather than 24.
+    template <class T>
+    struct BasicDataPoint2D {
+        T x {0};
+        T y {0};
+    };
+    template <class T>
+    using BasicDataContainer2D = std::vector<BasicDataPoint2D<T>>;
+
+    // The CoordinateTraits class template describes how the input values are
+    // converted to the coordinate type and back, and which type the
+    // orientation tests are evaluated in.
+    template <class T>
+    struct CoordinateTraits;
+
+    // Double precision coordinates without the angle of DataPoint2D. The
+    // scale is ignored.
+    template <>
+    struct CoordinateTraits<double> {
+        typedef double WideType;
+        static bool fromDouble(double value, double, double& coord) noexcept {
+            coord = value;
+            return true;
+        }
+        static double toDouble(double coord, double) noexcept {
+            return coord;
+        }
+    };
+
+    // Single precision coordinates. The orientation tests are evaluated with
+    // the robust double precision predicate.
+    template <>
+    struct CoordinateTraits<float> {
+        typedef double WideType;
+        static bool fromDouble(double value, double, float& coord) noexcept {
+            coord = float(value);
+            return std::isfinite(coord);
+        }
+        static double toDouble(float coord, double) noexcept {
+            return double(coord);
+        }
+    };
+
+    // Fixed-point coordinates. A value is multiplied by the scale and rounded
+    // to the nearest integer, e.g. with the scale of 10000 the input value of
+    // 0.1234 is stored as 1234. The magnitude of a coordinate is limited to
+    // 2^30 - 1, so the differences of the coordinates fit into 31 bits and
+    // the cross products evaluated in 64 bit integers are exact.
+    template <>
+    struct CoordinateTraits<int32_t> {
+        typedef int64_t WideType;
+        static const int32_t maxMagnitude {(int32_t(1) << 30) - 1};
+        static bool fromDouble(double value, double scale, int32_t& coord) noexcept {
+            double scaled = std::round(value * scale);
+            if(!(std::fabs(scaled) <= double(maxMagnitude)))
+                return false;
+            coord = int32_t(scaled);
+            return true;
+        }
+        static double toDouble(int32_t coord, double scale) noexcept {
+            return double(coord) / scale;
+        }
+    };
+
+    // Calculates the z component of the cross product of the following two
+    // vectors in the wide type of the coordinates:
+    //  - (a - origin);
+    //  - (b - origin).
+    // A positive result means a counter-clockwise turn from the first vector
+    // to the second one, a negative result means a clockwise turn and zero
+    // means the three points are collinear. The result is exact for the
+    // fixed-point coordinates. The overloads for DataPoint2D and for the
+    // float and double coordinates call calcOrientation2D, so their signs
+    // are exact too.
+    template <class T>
+    typename CoordinateTraits<T>::WideType calcCrossProduct2D(const BasicDataPoint2D<T>& origin,
+            const BasicDataPoint2D<T>& a, const BasicDataPoint2D<T>& b) noexcept {
+        typedef typename CoordinateTraits<T>::WideType W;
+        return (W(a.x) - W(origin.x)) * (W(b.y) - W(origin.y))
+            - (W(a.y) - W(origin.y)) * (W(b.x) - W(origin.x));
+    }
+    inline double calcCrossProduct2D(const BasicDataPoint2D<float>& origin,
+            const BasicDataPoint2D<float>& a, const BasicDataPoint2D<float>& b) noexcept {
+        return calcOrientation2D(origin.x, origin.y, a.x, a.y, b.x, b.y);
+    }
+    inline double calcCrossProduct2D(const BasicDataPoint2D<double>& origin,
+            const BasicDataPoint2D<double>& a, const BasicDataPoint2D<double>& b) noexcept {
+        return calcOrientation2D(origin.x, origin.y, a.x, a.y, b.x, b.y);
+    }
+    inline double calcCrossProduct2D(const DataPoint2D& origin,
+            const DataPoint2D& a, const DataPoint2D& b) noexcept {
+        return calcOrientation2D(origin.x, origin.y, a.x, a.y, b.x, b.y);
+    }
+
+    // Templated versions of the cullInteriorPoints and calcConvexHull2D_mc
+    // functions (see ch_alg2d.hpp). The results are the same as those of the
+    // double precision versions applied to the converted coordinates.
+    template <class T>
+    size_t cullInteriorPoints(BasicDataContainer2D<T>& dataStore) noexcept;
+    template <class T>
+    void calcConvexHull2D_mc(BasicDataContainer2D<T>& convexHull2D, BasicDataContainer2D<T>& dataStore,
+        bool bKeepCollinear = false) noexcept;
+
+    // The building blocks of the hull functions. They work with any point
+    // type that has an overload of calcCrossProduct2D, including DataPoint2D.
+    //
+    // cullRange2D reorders the [first, last) range moving the points located
+    // strictly inside the Akl-Toussaint octagon to the end of the range and
+    // returns the end of the retained points.
+    //
+    // buildHull2D_mc sorts the [first, last) range by x (then by y) and builds
+    // a closed line loop of the convex hull using Andrew's monotone chain
+    // algorithm. If bKeepCollinear is true then the points located on the
+    // edges of the hull are retained as vertices. Duplicate points are
+    // reported once either way.
+    //
+    // findOctagon2D finds the extreme points of the [first, last) range in
+    // the eight directions used by the culling stage, copies the distinct
+    // ones to octagon in the counter-clockwise order and returns their
+    // number. isInsideOctagon2D tells whether the point is located strictly
+    // inside the octagon.
+    template <class Iterator>
+    Iterator cullRange2D(Iterator first, Iterator last) noexcept;
+    template <class Iterator, class Point>
+    size_t findOctagon2D(Iterator first, Iterator last, Point (&octagon)[8]) noexcept;
+    template <class Point>
+    bool isInsideOctagon2D(const Point (&octagon)[8], size_t nVertices, const Point& point) noexcept;
+    template <class Point, class Iterator>
+    void buildHull2D_mc(std::vector<Point>& convexHull2D, Iterator first, Iterator last,
+        bool bKeepCollinear) noexcept;
+
+};   // namespace dk
+
+#include "ch_prec2d.inl"
+
+#endif // ch_prec2d_hpp
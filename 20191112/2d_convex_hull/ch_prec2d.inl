@@ -0,0 +1,195 @@
+/* ch_prec2d.inl
+This header file defines the hull functions templated on the point type.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Added the collinear point option.
+    17/Oct/2026 - Split the octagon search out of cullRange2D.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+namespace dk {
+
+    template <class Point>
+    bool compFunc4SortXY2D(const Point& p1, const Point& p2) noexcept {
+        if(p1.x < p2.x)
+            return true;
+        if(p1.x == p2.x && p1.y < p2.y)
+            return true;
+        return false;
+    }
+
+    template <class Iterator, class Point>
+    size_t findOctagon2D(Iterator first, Iterator last, Point (&octagon)[8]) noexcept {
+        // Sums and differences of the coordinates are evaluated in the type of
+        // the orientation tests to preclude overflows.
+        typedef decltype(calcCrossProduct2D(*first, *first, *first)) W;
+
+        size_t nPoints = size_t(last - first);
+        if(nPoints == 0)
+            return 0;
+
+        // Indices of the extreme points listed in the counter-clockwise order
+        // starting with the rightmost point:
+        //  max x, max x+y, max y, min x-y, min x, min x+y, min y, max x-y.
+        size_t inxExtreme[8] {0, 0, 0, 0, 0, 0, 0, 0};
+        auto sumOf = [](const Point& point) { return W(point.x) + W(point.y); };
+        auto diffOf = [](const Point& point) { return W(point.x) - W(point.y); };
+        for(size_t inx = 1; inx < nPoints; inx++) {
+            const Point& point = first[inx];
+            if(point.x > first[inxExtreme[0]].x)
+                inxExtreme[0] = inx;
+            if(sumOf(point) > sumOf(first[inxExtreme[1]]))
+                inxExtreme[1] = inx;
+            if(point.y > first[inxExtreme[2]].y)
+                inxExtreme[2] = inx;
+            if(diffOf(point) < diffOf(first[inxExtreme[3]]))
+                inxExtreme[3] = inx;
+            if(point.x < first[inxExtreme[4]].x)
+                inxExtreme[4] = inx;
+            if(sumOf(point) < sumOf(first[inxExtreme[5]]))
+                inxExtreme[5] = inx;
+            if(point.y < first[inxExtreme[6]].y)
+                inxExtreme[6] = inx;
+            if(diffOf(point) > diffOf(first[inxExtreme[7]]))
+                inxExtreme[7] = inx;
+        }
+
+        // Copy the vertices of the octagon skipping coincident neighbours.
+        size_t nVertices {0};
+        for(size_t inx : inxExtreme) {
+            const Point& vertex = first[inx];
+            if(nVertices > 0 && vertex.x == octagon[nVertices - 1].x
+                    && vertex.y == octagon[nVertices - 1].y)
+                continue;
+            octagon[nVertices++] = vertex;
+        }
+        if(nVertices > 1 && octagon[0].x == octagon[nVertices - 1].x
+                && octagon[0].y == octagon[nVertices - 1].y)
+            nVertices--;
+        return nVertices;
+    }
+
+    template <class Point>
+    bool isInsideOctagon2D(const Point (&octagon)[8], size_t nVertices, const Point& point) noexcept {
+        typedef decltype(calcCrossProduct2D(point, point, point)) W;
+
+        // A degenerate octagon has no interior.
+        if(nVertices < 3)
+            return false;
+        for(size_t inx = 0; inx < nVertices; inx++) {
+            const Point& v1 = octagon[inx];
+            const Point& v2 = octagon[inx + 1 < nVertices ? inx + 1 : 0];
+            if(calcCrossProduct2D(v1, v2, point) <= W(0))
+                return false;
+        }
+        return true;
+    }
+
+    template <class Iterator>
+    Iterator cullRange2D(Iterator first, Iterator last) noexcept {
+        typedef typename std::iterator_traits<Iterator>::value_type Point;
+
+        if(last - first < 3)
+            return last;
+
+        Point octagon[8];
+        size_t nVertices = findOctagon2D(first, last, octagon);
+        if(nVertices < 3)
+            return last;
+
+        auto isInterior = [&octagon, nVertices](const Point& point) {
+            return isInsideOctagon2D(octagon, nVertices, point);
+        };
+        return std::remove_if(first, last, isInterior);
+    }
+
+    template <class Point, class Iterator>
+    void buildHull2D_mc(std::vector<Point>& convexHull2D, Iterator first, Iterator last,
+            bool bKeepCollinear) noexcept {
+        typedef decltype(calcCrossProduct2D(*first, *first, *first)) W;
+
+        convexHull2D.clear();
+        if(first == last)
+            return;
+
+        std::sort(first, last, compFunc4SortXY2D<Point>);
+
+        size_t nPoints = size_t(last - first);
+        if(nPoints < 3) {
+            convexHull2D.assign(first, last);
+            convexHull2D.push_back(*first);
+            return;
+        }
+
+        // A point that is collinear with the last edge of the chain replaces
+        // the end of the edge unless the collinear points are to be retained.
+        // Duplicate points would make zero length edges, so they are skipped
+        // in the latter case.
+        auto isDuplicate = [first](size_t inx, size_t inxNeighbour) {
+            return first[inx].x == first[inxNeighbour].x && first[inx].y == first[inxNeighbour].y;
+        };
+        auto isRedundant = [bKeepCollinear](W crossProduct) {
+            return bKeepCollinear ? crossProduct < W(0) : crossProduct <= W(0);
+        };
+
+        // Lower chain.
+        size_t nDistinct {0};
+        for(size_t inx = 0; inx < nPoints; inx++) {
+            if(bKeepCollinear && inx > 0 && isDuplicate(inx, inx - 1))
+                continue;
+            nDistinct++;
+            while(convexHull2D.size() >= 2 &&
+                isRedundant(calcCrossProduct2D(convexHull2D[convexHull2D.size() - 2],
+                    convexHull2D.back(), first[inx])))
+                convexHull2D.pop_back();
+            convexHull2D.push_back(first[inx]);
+        }
+
+        // If all points are collinear and retained then the upper chain would
+        // retrace the lower one, so close the loop straight away.
+        if(bKeepCollinear && convexHull2D.size() == nDistinct) {
+            const Point& leftmost = convexHull2D.front();
+            const Point& rightmost = convexHull2D.back();
+            size_t inx {1};
+            while(inx < convexHull2D.size() - 1
+                    && calcCrossProduct2D(leftmost, rightmost, convexHull2D[inx]) == W(0))
+                inx++;
+            if(inx >= convexHull2D.size() - 1) {
+                convexHull2D.push_back(convexHull2D.front());
+                return;
+            }
+        }
+
+        // Upper chain. The rightmost point is already there, so start with the
+        // one preceding it and never pop below the end of the lower chain.
+        size_t lowerChainSize = convexHull2D.size() + 1;
+        for(size_t inx = nPoints - 1; inx-- > 0; ) {
+            if(bKeepCollinear && isDuplicate(inx, inx + 1))
+                continue;
+            while(convexHull2D.size() >= lowerChainSize &&
+                isRedundant(calcCrossProduct2D(convexHull2D[convexHull2D.size() - 2],
+                    convexHull2D.back(), first[inx])))
+                convexHull2D.pop_back();
+            convexHull2D.push_back(first[inx]);
+        }
+    }
+
+    template <class T>
+    size_t cullInteriorPoints(BasicDataContainer2D<T>& dataStore) noexcept {
+        auto it = cullRange2D(dataStore.begin(), dataStore.end());
+        size_t nCulled = size_t(dataStore.end() - it);
+        dataStore.erase(it, dataStore.end());
+        return nCulled;
+    }
+    template <class T>
+    void calcConvexHull2D_mc(BasicDataContainer2D<T>& convexHull2D, BasicDataContainer2D<T>& dataStore,
+            bool bKeepCollinear) noexcept {
+        buildHull2D_mc(convexHull2D, dataStore.begin(), dataStore.end(), bKeepCollinear);
+    }
+
+};   // namespace dk
@@ -0,0 +1,88 @@
+/* ch_pred2d.cpp
+This module defines the exact stages of the robust orientation predicates.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Added the exact cross product of two edges.
+*/
+
+#include <cmath>
+#include "ch_pred2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+// The exact evaluation represents values as expansions, i.e. sums of
+// doubles of increasing magnitude that don't overlap. The helpers below are
+// the error-free transformations the expansions are built with.
+
+// Calculates sum + error == a + b exactly.
+static inline void twoSum(double a, double b, double& sum, double& error) noexcept {
+    sum = a + b;
+    double bVirtual = sum - a;
+    double aVirtual = sum - bVirtual;
+    error = (a - aVirtual) + (b - bVirtual);
+}
+// Calculates product + error == a * b exactly.
+static inline void twoProduct(double a, double b, double& product, double& error) noexcept {
+    product = a * b;
+    error = fma(a, b, -product);
+}
+// Adds the value to the expansion in place dropping zero components.
+// Returns the new number of components. The expansion must have room for
+// one more component.
+static size_t growExpansion(double* expansion, size_t nComponents, double value) noexcept {
+    size_t nResult {0};
+    for(size_t inx = 0; inx < nComponents; inx++) {
+        double error;
+        twoSum(value, expansion[inx], value, error);
+        if(error != 0.0)
+            expansion[nResult++] = error;
+    }
+    if(value != 0.0)
+        expansion[nResult++] = value;
+    return nResult;
+}
+
+// Sums the products of the pairs of factors exactly and returns -1.0, 0.0
+// or +1.0 depending on the sign of the sum. Each product is an expansion of
+// two components, so the expansion must have room for twice as many
+// components as there are products plus one.
+static double calcSignOfProducts(const double (*factors)[2], size_t nProducts,
+        double* expansion) noexcept {
+    size_t nComponents {0};
+    for(size_t inx = 0; inx < nProducts; inx++) {
+        double product, error;
+        twoProduct(factors[inx][0], factors[inx][1], product, error);
+        nComponents = growExpansion(expansion, nComponents, error);
+        nComponents = growExpansion(expansion, nComponents, product);
+    }
+
+    // The sign of an expansion is the sign of its largest component.
+    if(nComponents == 0)
+        return 0.0;
+    return expansion[nComponents - 1] > 0.0 ? 1.0 : -1.0;
+}
+
+double dk::calcOrientation2D_exact(double ox, double oy, double ax, double ay,
+        double bx, double by) noexcept {
+    // (ax - ox) * (by - oy) - (ay - oy) * (bx - ox) expands into six products
+    // of the coordinates.
+    const double factors[6][2] {
+        {ax, by}, {-ax, oy}, {-ox, by}, {-ay, bx}, {ay, ox}, {oy, bx}
+    };
+    double expansion[13];
+    return calcSignOfProducts(factors, 6, expansion);
+}
+double dk::calcEdgeOrientation2D_exact(double ax, double ay, double bx, double by,
+        double cx, double cy, double dx, double dy) noexcept {
+    // (bx - ax) * (dy - cy) - (by - ay) * (dx - cx) expands into eight
+    // products of the coordinates.
+    const double factors[8][2] {
+        {bx, dy}, {-bx, cy}, {-ax, dy}, {ax, cy}, {-by, dx}, {by, cx}, {ay, dx}, {-ay, cx}
+    };
+    double expansion[17];
+    return calcSignOfProducts(factors, 8, expansion);
+}
@@ -0,0 +1,122 @@
+/* ch_pred2d.hpp
+This module declares the robust orientation predicate of the 2D Convex Hull
+application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Added the robust cross product of two edges.
+*/
+
+#ifndef ch_pred2d_hpp
+#define ch_pred2d_hpp
+
+#include <cfloat>
+
+namespace dk {
+
+    // Evaluates the z component of the cross product of (a - o) and (b - o)
+    // exactly, i.e. as if the arithmetic had infinite precision, and returns
+    // -1.0, 0.0 or +1.0 depending on its sign. Used by calcOrientation2D.
+    double calcOrientation2D_exact(double ox, double oy, double ax, double ay,
+        double bx, double by) noexcept;
+
+    // Calculates the z component of the cross product of the following two
+    // vectors:
+    //  - (a - o);
+    //  - (b - o).
+    // Unlike a plain double precision evaluation of the cross product the sign
+    // of the result is always correct, which is why calcCrossProduct2D calls
+    // it for the floating-point coordinates. The predicate is adaptive: the cross product is evaluated in
+    // double precision first and the result is returned straight away unless
+    // its magnitude is within the worst case rounding error bound. Only the
+    // nearly collinear cases fall back to the exact evaluation, which is
+    // much slower but rare on typical datasets. Only the sign of the result
+    // is meaningful.
+    //
+    // The exact evaluation assumes that the products of the coordinates
+    // neither overflow nor underflow.
+    inline double calcOrientation2D(double ox, double oy, double ax, double ay,
+            double bx, double by) noexcept {
+        // The error bound of the filter, see J.R. Shewchuk, "Adaptive
+        // Precision Floating-Point Arithmetic and Fast Robust Geometric
+        // Predicates".
+        const double epsilon {DBL_EPSILON / 2.0};
+        const double errorBoundFactor {(3.0 + 16.0 * epsilon) * epsilon};
+
+        double detLeft = (ax - ox) * (by - oy);
+        double detRight = (ay - oy) * (bx - ox);
+        double det = detLeft - detRight;
+
+        // If the two products have different signs then no cancellation
+        // occurs and the sign of the difference is correct.
+        double detSum;
+        if(detLeft > 0.0) {
+            if(detRight <= 0.0)
+                return det;
+            detSum = detLeft + detRight;
+        }
+        else if(detLeft < 0.0) {
+            if(detRight >= 0.0)
+                return det;
+            detSum = -detLeft - detRight;
+        }
+        else
+            return det;
+
+        double errorBound = errorBoundFactor * detSum;
+        if(det >= errorBound || -det >= errorBound)
+            return det;
+        return calcOrientation2D_exact(ox, oy, ax, ay, bx, by);
+    }
+
+    // Evaluates the z component of the cross product of (b - a) and (d - c)
+    // exactly and returns -1.0, 0.0 or +1.0 depending on its sign. Used by
+    // calcEdgeOrientation2D.
+    double calcEdgeOrientation2D_exact(double ax, double ay, double bx, double by,
+        double cx, double cy, double dx, double dy) noexcept;
+
+    // Calculates the z component of the cross product of the following two
+    // vectors:
+    //  - (b - a);
+    //  - (d - c).
+    // A positive result means the direction of the second edge is a
+    // counter-clockwise turn from the direction of the first one. The
+    // predicate compares the slopes of two edges that don't share an end
+    // point and works the same way as calcOrientation2D, which is the
+    // special case of c == a. Only the sign of the result is meaningful.
+    inline double calcEdgeOrientation2D(double ax, double ay, double bx, double by,
+            double cx, double cy, double dx, double dy) noexcept {
+        // Each factor is a single rounded difference like in
+        // calcOrientation2D, so the same error bound applies.
+        const double epsilon {DBL_EPSILON / 2.0};
+        const double errorBoundFactor {(3.0 + 16.0 * epsilon) * epsilon};
+
+        double detLeft = (bx - ax) * (dy - cy);
+        double detRight = (by - ay) * (dx - cx);
+        double det = detLeft - detRight;
+
+        double detSum;
+        if(detLeft > 0.0) {
+            if(detRight <= 0.0)
+                return det;
+            detSum = detLeft + detRight;
+        }
+        else if(detLeft < 0.0) {
+            if(detRight >= 0.0)
+                return det;
+            detSum = -detLeft - detRight;
+        }
+        else
+            return det;
+
+        double errorBound = errorBoundFactor * detSum;
+        if(det >= errorBound || -det >= errorBound)
+            return det;
+        return calcEdgeOrientation2D_exact(ax, ay, bx, by, cx, cy, dx, dy);
+    }
+
+};   // namespace dk
+
+#endif // ch_pred2d_hpp
@@ -0,0 +1,198 @@
+/* ch_prof2d.cpp
+This module implements the phase profiler of the 2D Convex Hull application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Matched the statement style of the directory.
+*/
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include <iomanip>
+#include "ch_prof2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+// The names of the hardware counters in the text and the JSON reports.
+static const char* counterTitles[] = { "Cycles", "Cache misses", "Branch misses" };
+static const char* counterKeys[] = { "cycles", "cache_misses", "branch_misses" };
+
+#ifdef __linux__
+// Opens a counter of the hardware event for the calling process and the
+// threads it starts afterwards. Returns -1 on failure.
+static int openCounter(uint64_t event) noexcept {
+    perf_event_attr attr {};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = event;
+    attr.inherit = 1;
+    // User space only, which is allowed at the default paranoia level.
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+#endif
+
+// Returns the peak resident set size of the process in bytes.
+static uint64_t getPeakMemory() noexcept {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if(!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return uint64_t(usage.ru_maxrss);
+#else
+    return uint64_t(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+PhaseProfiler2D::PhaseProfiler2D(bool bEnabled)
+    : bEnabled_{ bEnabled }, bPhaseStarted_{ false }, phaseStartCounters_{},
+    counterFds_{ -1, -1, -1 }, iNumPoints_{ 0 }, iNumCulled_{ 0 }, iHullSize_{ 0 }
+{
+#ifdef __linux__
+    if(!bEnabled_)
+        return;
+    const uint64_t events[counterCount] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for(size_t inx = 0; inx < counterCount; inx++)
+        counterFds_[inx] = openCounter(events[inx]);
+#endif
+}
+PhaseProfiler2D::~PhaseProfiler2D() {
+#ifdef __linux__
+    for(int fd : counterFds_)
+        if(fd >= 0)
+            close(fd);
+#endif
+}
+void PhaseProfiler2D::readCounters(int64_t* values) const noexcept {
+    for(size_t inx = 0; inx < counterCount; inx++) {
+        values[inx] = -1;
+#ifdef __linux__
+        uint64_t value;
+        if(counterFds_[inx] >= 0 && read(counterFds_[inx], &value, sizeof(value)) == sizeof(value))
+            values[inx] = int64_t(value);
+#endif
+    }
+}
+void PhaseProfiler2D::startPhase(const char* name) {
+    if(!bEnabled_)
+        return;
+    endPhase();
+    phases_.push_back(Phase{ name, 0.0, {} });
+    bPhaseStarted_ = true;
+    readCounters(phaseStartCounters_);
+    phaseStart_ = chrono::steady_clock::now();
+}
+void PhaseProfiler2D::endPhase() {
+    if(!bPhaseStarted_)
+        return;
+    auto finish = chrono::steady_clock::now();
+    Phase& phase = phases_.back();
+    phase.seconds = chrono::duration<double>(finish - phaseStart_).count();
+    readCounters(phase.counters);
+    for(size_t inx = 0; inx < counterCount; inx++)
+        if(phase.counters[inx] >= 0 && phaseStartCounters_[inx] >= 0)
+            phase.counters[inx] -= phaseStartCounters_[inx];
+        else
+            phase.counters[inx] = -1;
+    bPhaseStarted_ = false;
+}
+void PhaseProfiler2D::setPointCount(size_t iNumPoints) noexcept {
+    iNumPoints_ = iNumPoints;
+}
+void PhaseProfiler2D::setCulledCount(size_t iNumCulled) noexcept {
+    iNumCulled_ = iNumCulled;
+}
+void PhaseProfiler2D::setHullSize(size_t iHullSize) noexcept {
+    iHullSize_ = iHullSize;
+}
+bool PhaseProfiler2D::enabled() const noexcept {
+    return bEnabled_;
+}
+void PhaseProfiler2D::writeText(ostream& outStream) const {
+    auto writeCounter = [&outStream](int64_t value) {
+        outStream << setw(16);
+        if(value >= 0)
+            outStream << value;
+        else
+            outStream << "n/a";
+    };
+
+    outStream << "Profile:" << '\n';
+    outStream << left << setw(24) << "  Phase" << right << setw(12) << "Seconds";
+    for(const char* title : counterTitles)
+        outStream << setw(16) << title;
+    outStream << '\n';
+
+    double totalSeconds {0.0};
+    int64_t totalCounters[counterCount] {};
+    for(const auto& phase : phases_) {
+        outStream << "  " << left << setw(22) << phase.name << right
+            << setw(12) << fixed << setprecision(6) << phase.seconds << defaultfloat;
+        totalSeconds += phase.seconds;
+        for(size_t inx = 0; inx < counterCount; inx++) {
+            writeCounter(phase.counters[inx]);
+            totalCounters[inx] = totalCounters[inx] >= 0 && phase.counters[inx] >= 0 ?
+                totalCounters[inx] + phase.counters[inx] : -1;
+        }
+        outStream << '\n';
+    }
+    outStream << "  " << left << setw(22) << "total" << right
+        << setw(12) << fixed << setprecision(6) << totalSeconds << defaultfloat;
+    for(size_t inx = 0; inx < counterCount; inx++)
+        writeCounter(phases_.empty() ? -1 : totalCounters[inx]);
+    outStream << '\n';
+
+    outStream << "Points in: " << iNumPoints_ << '\n';
+    outStream << "Points culled: " << iNumCulled_ << '\n';
+    outStream << "Hull size: " << iHullSize_ << '\n';
+    outStream << "Peak memory, MB: " << fixed << setprecision(1)
+        << double(getPeakMemory()) / (1 << 20) << defaultfloat << '\n';
+}
+void PhaseProfiler2D::writeJSON(ostream& outStream) const {
+    auto writeCounter = [&outStream](int64_t value) {
+        if(value >= 0)
+            outStream << value;
+        else
+            outStream << "null";
+    };
+
+    // The phase names are plain identifiers, so they need no escaping.
+    outStream << "{\"phases\":[";
+    for(size_t inxPhase = 0; inxPhase < phases_.size(); inxPhase++) {
+        const Phase& phase = phases_[inxPhase];
+        outStream << (inxPhase ? "," : "") << "{\"name\":\"" << phase.name << "\",\"seconds\":"
+            << setprecision(9) << phase.seconds << setprecision(6);
+        for(size_t inx = 0; inx < counterCount; inx++) {
+            outStream << ",\"" << counterKeys[inx] << "\":";
+            writeCounter(phase.counters[inx]);
+        }
+        outStream << '}';
+    }
+    outStream << "],\"points_in\":" << iNumPoints_ << ",\"points_culled\":" << iNumCulled_
+        << ",\"hull_size\":" << iHullSize_ << ",\"peak_memory_bytes\":" << getPeakMemory() << '}' << '\n';
+}
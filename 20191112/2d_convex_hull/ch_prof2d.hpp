@@ -0,0 +1,83 @@
+/* ch_prof2d.hpp
+This module declares the phase profiler of the 2D Convex Hull application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch_prof2d_hpp
+#define ch_prof2d_hpp
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace dk {
+
+    // The PhaseProfiler2D class measures the wall time of the consecutive
+    // phases of a calculation, e.g. reading the input file, sorting and
+    // scanning the points and writing the output, and reports them along
+    // with the point counts and the peak memory footprint of the process.
+    //
+    // Where the operating system provides them (Linux perf_event_open) the
+    // CPU cycles, the cache misses and the branch misses of every phase are
+    // counted as well. The counters include the threads started by the
+    // process once they have finished. If they can't be opened, e.g. because
+    // of the perf_event_paranoid setting or in a virtual machine without a
+    // PMU, the report shows them as not available.
+    //
+    // A disabled profiler does nothing, so the calculation code can call it
+    // unconditionally.
+    class PhaseProfiler2D {
+    public:
+        explicit PhaseProfiler2D(bool bEnabled);
+        ~PhaseProfiler2D();
+        PhaseProfiler2D(const PhaseProfiler2D&) = delete;
+        PhaseProfiler2D& operator=(const PhaseProfiler2D&) = delete;
+
+        // Ends the current phase, if any, and starts the named one.
+        void startPhase(const char* name);
+        // Ends the current phase, if any.
+        void endPhase();
+
+        void setPointCount(size_t iNumPoints) noexcept;
+        void setCulledCount(size_t iNumCulled) noexcept;
+        void setHullSize(size_t iHullSize) noexcept;
+
+        bool enabled() const noexcept;
+
+        // Write the report in a human readable table or as a JSON object.
+        void writeText(std::ostream& outStream) const;
+        void writeJSON(std::ostream& outStream) const;
+
+    private:
+        static const size_t counterCount {3};
+
+        struct Phase {
+            std::string name;
+            double seconds;
+            // Negative values stand for the counters that aren't available.
+            int64_t counters[counterCount];
+        };
+
+        void readCounters(int64_t* values) const noexcept;
+
+        bool bEnabled_;
+        std::vector<Phase> phases_;
+        bool bPhaseStarted_;
+        std::chrono::steady_clock::time_point phaseStart_;
+        int64_t phaseStartCounters_[counterCount];
+        // The file descriptors of the hardware counters, -1 if unavailable.
+        int counterFds_[counterCount];
+        size_t iNumPoints_;
+        size_t iNumCulled_;
+        size_t iHullSize_;
+    };
+
+};   // namespace dk
+
+#endif // ch_prof2d_hpp
@@ -0,0 +1,326 @@
+/* ch_soa2d.cpp
+This module implements the structure-of-arrays point container and the
+vectorised kernels of the 2D Convex Hull algorithm.
+
+There are three flavours of each kernel: AVX2, SSE2 and scalar. The AVX2
+kernels are compiled with a function level target attribute and selected at
+run time if the CPU supports AVX2, so the rest of the application doesn't
+need to be compiled for AVX2. With MSVC the AVX2 kernels are only available
+if the module is compiled with /arch:AVX2.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Sort the points with the angle sort of the DataContainer path.
+    17/Oct/2026 - Sum up the centroid in the order of the DataContainer path,
+                  added the angle policies and the culling stage.
+    17/Oct/2026 - Matched the statement style of the directory.
+*/
+
+#include <algorithm>
+#include "ch_prec2d.hpp"
+#include "ch_soa2d.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define CH_SOA_SSE2
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define CH_SOA_AVX2
+#define CH_SOA_AVX2_TARGET __attribute__((target("avx2")))
+static bool cpuSupportsAVX2() noexcept { return __builtin_cpu_supports("avx2"); }
+#elif defined(__AVX2__)
+#define CH_SOA_AVX2
+#define CH_SOA_AVX2_TARGET
+static bool cpuSupportsAVX2() noexcept { return true; }
+#endif
+#endif
+
+using namespace std;
+using namespace dk;
+
+// The farthest point search examines blocks of this many points. A block is
+// only rescanned for the index of the farthest point if its maximum beats
+// the maximum of the previous blocks.
+const size_t farthestSearchBlockSize {1024};
+
+// The alpha kernel calculates dot products and determinants of a block of
+// this many points before calculating their angles.
+const size_t alphaBlockSize {256};
+
+// Scalar kernels.
+static double maxDistSqr_scalar(const double* x, const double* y, size_t n, double ox, double oy) noexcept {
+    double maxDistSqr {0.0};
+    for(size_t inx = 0; inx < n; inx++) {
+        double dX = x[inx] - ox;
+        double dY = y[inx] - oy;
+        maxDistSqr = max(maxDistSqr, dX*dX + dY*dY);
+    }
+    return maxDistSqr;
+}
+static void dotDet_scalar(const double* x, const double* y, size_t n, double ox, double oy,
+        double vx, double vy, double* dot, double* det) noexcept {
+    for(size_t inx = 0; inx < n; inx++) {
+        double dX = x[inx] - ox;
+        double dY = y[inx] - oy;
+        dot[inx] = vx * dX + vy * dY;
+        det[inx] = vx * dY - vy * dX;
+    }
+}
+
+#ifdef CH_SOA_SSE2
+static double maxDistSqr_sse2(const double* x, const double* y, size_t n, double ox, double oy) noexcept {
+    __m128d vox = _mm_set1_pd(ox);
+    __m128d voy = _mm_set1_pd(oy);
+    __m128d vmax = _mm_setzero_pd();
+    size_t inx {0};
+    for(; inx + 2 <= n; inx += 2) {
+        __m128d dX = _mm_sub_pd(_mm_loadu_pd(x + inx), vox);
+        __m128d dY = _mm_sub_pd(_mm_loadu_pd(y + inx), voy);
+        vmax = _mm_max_pd(vmax, _mm_add_pd(_mm_mul_pd(dX, dX), _mm_mul_pd(dY, dY)));
+    }
+    double buf[2];
+    _mm_storeu_pd(buf, vmax);
+    return max(max(buf[0], buf[1]), maxDistSqr_scalar(x + inx, y + inx, n - inx, ox, oy));
+}
+static void dotDet_sse2(const double* x, const double* y, size_t n, double ox, double oy,
+        double vx, double vy, double* dot, double* det) noexcept {
+    __m128d vox = _mm_set1_pd(ox);
+    __m128d voy = _mm_set1_pd(oy);
+    __m128d vvx = _mm_set1_pd(vx);
+    __m128d vvy = _mm_set1_pd(vy);
+    size_t inx {0};
+    for(; inx + 2 <= n; inx += 2) {
+        __m128d dX = _mm_sub_pd(_mm_loadu_pd(x + inx), vox);
+        __m128d dY = _mm_sub_pd(_mm_loadu_pd(y + inx), voy);
+        _mm_storeu_pd(dot + inx, _mm_add_pd(_mm_mul_pd(vvx, dX), _mm_mul_pd(vvy, dY)));
+        _mm_storeu_pd(det + inx, _mm_sub_pd(_mm_mul_pd(vvx, dY), _mm_mul_pd(vvy, dX)));
+    }
+    dotDet_scalar(x + inx, y + inx, n - inx, ox, oy, vx, vy, dot + inx, det + inx);
+}
+#endif  // CH_SOA_SSE2
+
+#ifdef CH_SOA_AVX2
+CH_SOA_AVX2_TARGET
+static double maxDistSqr_avx2(const double* x, const double* y, size_t n, double ox, double oy) noexcept {
+    __m256d vox = _mm256_set1_pd(ox);
+    __m256d voy = _mm256_set1_pd(oy);
+    __m256d vmax = _mm256_setzero_pd();
+    size_t inx {0};
+    for(; inx + 4 <= n; inx += 4) {
+        __m256d dX = _mm256_sub_pd(_mm256_loadu_pd(x + inx), vox);
+        __m256d dY = _mm256_sub_pd(_mm256_loadu_pd(y + inx), voy);
+        vmax = _mm256_max_pd(vmax, _mm256_add_pd(_mm256_mul_pd(dX, dX), _mm256_mul_pd(dY, dY)));
+    }
+    double buf[4];
+    _mm256_storeu_pd(buf, vmax);
+    double maxDistSqr = max(max(buf[0], buf[1]), max(buf[2], buf[3]));
+    return max(maxDistSqr, maxDistSqr_scalar(x + inx, y + inx, n - inx, ox, oy));
+}
+CH_SOA_AVX2_TARGET
+static void dotDet_avx2(const double* x, const double* y, size_t n, double ox, double oy,
+        double vx, double vy, double* dot, double* det) noexcept {
+    __m256d vox = _mm256_set1_pd(ox);
+    __m256d voy = _mm256_set1_pd(oy);
+    __m256d vvx = _mm256_set1_pd(vx);
+    __m256d vvy = _mm256_set1_pd(vy);
+    size_t inx {0};
+    for(; inx + 4 <= n; inx += 4) {
+        __m256d dX = _mm256_sub_pd(_mm256_loadu_pd(x + inx), vox);
+        __m256d dY = _mm256_sub_pd(_mm256_loadu_pd(y + inx), voy);
+        _mm256_storeu_pd(dot + inx, _mm256_add_pd(_mm256_mul_pd(vvx, dX), _mm256_mul_pd(vvy, dY)));
+        _mm256_storeu_pd(det + inx, _mm256_sub_pd(_mm256_mul_pd(vvx, dY), _mm256_mul_pd(vvy, dX)));
+    }
+    dotDet_scalar(x + inx, y + inx, n - inx, ox, oy, vx, vy, dot + inx, det + inx);
+}
+#endif  // CH_SOA_AVX2
+
+// A set of kernels implemented with a particular instruction set.
+struct Kernels {
+    const char* name;
+    double (*maxDistSqr)(const double*, const double*, size_t, double, double) noexcept;
+    void (*dotDet)(const double*, const double*, size_t, double, double, double, double, double*, double*) noexcept;
+};
+
+// Returns the set of kernels selected for the CPU the application runs on.
+static const Kernels& getKernels() noexcept {
+#ifdef CH_SOA_AVX2
+    static const Kernels avx2Kernels {"AVX2", maxDistSqr_avx2, dotDet_avx2};
+    if(cpuSupportsAVX2())
+        return avx2Kernels;
+#endif
+#ifdef CH_SOA_SSE2
+    static const Kernels sse2Kernels {"SSE2", maxDistSqr_sse2, dotDet_sse2};
+    return sse2Kernels;
+#else
+    static const Kernels scalarKernels {"scalar", maxDistSqr_scalar, dotDet_scalar};
+    return scalarKernels;
+#endif
+}
+
+size_t DataContainerSoA2D::size() const noexcept {
+    return x.size();
+}
+void DataContainerSoA2D::assign(const DataContainer& container) {
+    x.resize(container.size());
+    y.resize(container.size());
+    for(size_t inx = 0; inx < container.size(); inx++) {
+        x[inx] = container[inx].x;
+        y[inx] = container[inx].y;
+    }
+}
+void DataContainerSoA2D::push_back(const DataPoint2D& point) {
+    x.push_back(point.x);
+    y.push_back(point.y);
+}
+DataPoint2D DataContainerSoA2D::operator [] (size_t inx) const noexcept {
+    DataPoint2D point;
+    point.x = x[inx];
+    point.y = y[inx];
+    return point;
+}
+
+const char* dk::getSoAKernelName() noexcept {
+    return getKernels().name;
+}
+size_t dk::findFarthestSoA(const double* x, const double* y, size_t n, double ox, double oy) noexcept {
+    const Kernels& kernels = getKernels();
+    double maxDistSqr {0.0};
+    size_t inxFarthest {n};
+    for(size_t inxBlock = 0; inxBlock < n; inxBlock += farthestSearchBlockSize) {
+        size_t blockSize = min(farthestSearchBlockSize, n - inxBlock);
+        double blockMaxDistSqr = kernels.maxDistSqr(x + inxBlock, y + inxBlock, blockSize, ox, oy);
+        if(blockMaxDistSqr <= maxDistSqr)
+            continue;
+
+        // Locate the first point of the block that delivers the maximum.
+        maxDistSqr = blockMaxDistSqr;
+        for(size_t inx = inxBlock; inx < inxBlock + blockSize; inx++) {
+            double dX = x[inx] - ox;
+            double dY = y[inx] - oy;
+            if(dX*dX + dY*dY == maxDistSqr) {
+                inxFarthest = inx;
+                break;
+            }
+        }
+    }
+    return inxFarthest;
+}
+template <class AnglePolicy>
+void dk::calcAlphaSoA(const double* x, const double* y, size_t n, const DataPoint2D& tip,
+        const DataPoint2D& origin, double* alpha) noexcept {
+    const Kernels& kernels = getKernels();
+    double vx = tip.x - origin.x;
+    double vy = tip.y - origin.y;
+    double det[alphaBlockSize];
+    for(size_t inxBlock = 0; inxBlock < n; inxBlock += alphaBlockSize) {
+        size_t blockSize = min(alphaBlockSize, n - inxBlock);
+        // The dot products go straight into the output array and get
+        // replaced with the angles in the loop below.
+        double* dot = alpha + inxBlock;
+        kernels.dotDet(x + inxBlock, y + inxBlock, blockSize, origin.x, origin.y, vx, vy, dot, det);
+        for(size_t inx = 0; inx < blockSize; inx++)
+            dot[inx] = AnglePolicy::calcAngleOfProducts(dot[inx], det[inx]);
+    }
+}
+template void dk::calcAlphaSoA<Atan2AnglePolicy>(const double*, const double*, size_t,
+    const DataPoint2D&, const DataPoint2D&, double*) noexcept;
+template void dk::calcAlphaSoA<PseudoAnglePolicy>(const double*, const double*, size_t,
+    const DataPoint2D&, const DataPoint2D&, double*) noexcept;
+
+// Presents the points of the structure-of-arrays container as DataPoint2D
+// values to the octagon search of the culling stage.
+struct SoAPointIterator {
+    const double* x;
+    const double* y;
+
+    DataPoint2D operator [] (size_t inx) const noexcept {
+        DataPoint2D point;
+        point.x = x[inx];
+        point.y = y[inx];
+        return point;
+    }
+    DataPoint2D operator * () const noexcept {
+        return (*this)[0];
+    }
+    ptrdiff_t operator - (const SoAPointIterator& it) const noexcept {
+        return x - it.x;
+    }
+};
+
+void dk::calculateCentroid(const DataContainerSoA2D& soaStore,
+        DataPoint2D& centroid, const size_t subSampleSize) noexcept {
+    centroid.x = 0.0;
+    centroid.y = 0.0;
+
+    size_t effectvSubSampleSize = subSampleSize?
+        min(subSampleSize, soaStore.size()) : soaStore.size();
+    for(size_t inx = 0; inx < effectvSubSampleSize; inx++) {
+        centroid.x += soaStore.x[inx];
+        centroid.y += soaStore.y[inx];
+    }
+    centroid /= effectvSubSampleSize;
+}
+size_t dk::cullInteriorPoints(DataContainerSoA2D& soaStore) noexcept {
+    size_t nPoints = soaStore.size();
+    if(nPoints < 3)
+        return 0;
+
+    SoAPointIterator first {soaStore.x.data(), soaStore.y.data()};
+    SoAPointIterator last {first.x + nPoints, first.y + nPoints};
+    DataPoint2D octagon[8];
+    size_t nVertices = findOctagon2D(first, last, octagon);
+
+    // Keep the order of the retained points, like remove_if does in the
+    // DataContainer version.
+    size_t nRetained {0};
+    for(size_t inx = 0; inx < nPoints; inx++) {
+        if(isInsideOctagon2D(octagon, nVertices, first[inx]))
+            continue;
+        soaStore.x[nRetained] = soaStore.x[inx];
+        soaStore.y[nRetained] = soaStore.y[inx];
+        nRetained++;
+    }
+    soaStore.x.resize(nRetained);
+    soaStore.y.resize(nRetained);
+    return nPoints - nRetained;
+}
+template <class AnglePolicy>
+void dk::prepareData(const DataContainerSoA2D& soaStore, const DataPoint2D& centroid,
+        DataContainer& dataStore) {
+    size_t nPoints = soaStore.size();
+    dataStore.clear();
+    if(nPoints == 0)
+        return;
+
+    // Mimic getTipOfLongestVector, which falls back to the default point if
+    // all the points coincide with the centroid.
+    DataPoint2D tipOfLongestVector;
+    size_t inxTip = findFarthestSoA(soaStore.x.data(), soaStore.y.data(), nPoints, centroid.x, centroid.y);
+    if(inxTip < nPoints)
+        tipOfLongestVector = soaStore[inxTip];
+
+    AlignedDoubleVector alpha(nPoints);
+    calcAlphaSoA<AnglePolicy>(soaStore.x.data(), soaStore.y.data(), nPoints, tipOfLongestVector, centroid, alpha.data());
+
+    // Share the sort with the DataContainer path, so the points with equal
+    // angles end up in the same order. The points are gathered straight into
+    // that order.
+    vector<size_t> order;
+    sortByAngle(alpha.data(), nPoints, order);
+    dataStore.reserve(nPoints + 1);
+    dataStore.resize(nPoints);
+    for(size_t inx = 0; inx < nPoints; inx++) {
+        DataPoint2D& point = dataStore[inx];
+        size_t inxPoint = order[inx];
+        point.x = soaStore.x[inxPoint];
+        point.y = soaStore.y[inxPoint];
+        point.alpha = alpha[inxPoint];
+    }
+
+    // Put a copy of the first point at the end of the sequence
+    // to make sure the algorithm delivers a closed line loop.
+    dataStore.push_back(dataStore[0]);
+}
+template void dk::prepareData<Atan2AnglePolicy>(const DataContainerSoA2D&, const DataPoint2D&, DataContainer&);
+template void dk::prepareData<PseudoAnglePolicy>(const DataContainerSoA2D&, const DataPoint2D&, DataContainer&);
@@ -0,0 +1,99 @@
+/* ch_soa2d.hpp
+This module declares a structure-of-arrays point container along with
+vectorised kernels for the data preparation passes of the 2D Convex Hull
+algorithm.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Made the data preparation match the DataContainer path and
+                  added the culling stage.
+*/
+
+#ifndef ch_soa2d_hpp
+#define ch_soa2d_hpp
+
+#include <new>
+#include <vector>
+#include "ch_alg2d.hpp"
+
+namespace dk {
+
+    // Allocates memory aligned at the boundary of a cache line, which is
+    // also suitable for aligned SIMD loads.
+    template <class T, size_t Alignment = 64>
+    struct AlignedAllocator {
+        typedef T value_type;
+        template <class U> struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+        AlignedAllocator() noexcept {}
+        template <class U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        T* allocate(size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+        void deallocate(T* p, size_t) noexcept {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+        template <class U> bool operator == (const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+        template <class U> bool operator != (const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+    };
+
+    typedef std::vector<double, AlignedAllocator<double>> AlignedDoubleVector;
+
+    // Keeps the x and y coordinates of the points in two separate aligned
+    // arrays. Passes that only need the coordinates stream 16 bytes per point
+    // instead of the 24 bytes of DataPoint2D and vectorise well.
+    struct DataContainerSoA2D {
+        AlignedDoubleVector x;
+        AlignedDoubleVector y;
+
+        size_t size() const noexcept;
+        void assign(const DataContainer&);
+        void push_back(const DataPoint2D&);
+        DataPoint2D operator [] (size_t inx) const noexcept;
+    };
+
+    // Returns the name of the instruction set used by the kernels below:
+    // "AVX2", "SSE2" or "scalar". The AVX2 kernels are only used if the CPU
+    // supports them.
+    const char* getSoAKernelName() noexcept;
+
+    // Returns the index of the point farthest from the origin specified by
+    // (ox, oy). Ties resolve to the lowest index. Returns n if n is zero or
+    // all the points coincide with the origin.
+    size_t findFarthestSoA(const double* x, const double* y, size_t n, double ox, double oy) noexcept;
+
+    // For each point calculates the angle between the following two vectors:
+    //  - (point - origin);
+    //  - (tip - origin).
+    // The angles are measured by the angle policy and are identical to those
+    // delivered by AnglePolicy::calcAngle. The dot products and determinants
+    // are vectorised, the angle calculations are not. Both policies are
+    // explicitly instantiated in ch_soa2d.cpp.
+    template <class AnglePolicy = Atan2AnglePolicy>
+    void calcAlphaSoA(const double* x, const double* y, size_t n, const DataPoint2D& tip,
+        const DataPoint2D& origin, double* alpha) noexcept;
+
+    // These overloads provide the data preparation steps of the angle scan
+    // engine for the structure-of-arrays container. They produce the same
+    // result as their DataContainer counterparts as long as the compiler
+    // doesn't contract the floating point operations of the scalar code into
+    // fused multiply-adds. The centroid is summed up point by point in the
+    // input order like the DataContainer version does, because summing it
+    // up lane by lane changes its low order bits, and so the angles and the
+    // collinear points retained on the hull.
+    void calculateCentroid(const DataContainerSoA2D&, DataPoint2D& centroid, const size_t subSampleSize = 0) noexcept;
+    size_t cullInteriorPoints(DataContainerSoA2D& soaStore) noexcept;
+
+    // Calculates alpha of every point, then populates dataStore with the
+    // points sorted by alpha followed by a copy of the first point. The
+    // result is ready to be passed into calcConvexHull2D with the same angle
+    // policy.
+    template <class AnglePolicy = Atan2AnglePolicy>
+    void prepareData(const DataContainerSoA2D& soaStore, const DataPoint2D& centroid, DataContainer& dataStore);
+
+};   // namespace dk
+
+#endif // ch_soa2d_hpp
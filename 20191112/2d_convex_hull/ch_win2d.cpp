@@ -0,0 +1,209 @@
+/* ch_win2d.cpp
+This module implements the sliding window 2D Convex Hull engine.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Matched the statement style of the directory.
+*/
+
+#include <iterator>
+#include "ch_pred2d.hpp"
+#include "ch_win2d.hpp"
+
+using namespace std;
+using namespace dk;
+
+// Calculates the z component of the cross product of (a - o) and (b - o).
+// Negative values indicate a clockwise turn at a, which is what the
+// vertices of an upper hull traversed from left to right must deliver.
+static inline double cross(double ox, double oy, double ax, double ay, double bx, double by) noexcept {
+    return calcOrientation2D(ox, oy, ax, ay, bx, by);
+}
+
+void UndoableUpperHull2D::removeVertex(map<double, double>::iterator it) {
+    removedVertices_.emplace_back(it->first, it->second);
+    vertices_.erase(it);
+}
+void UndoableUpperHull2D::insert(double x, double y) {
+    // Same as UpperHull2D::insert apart from the undo log.
+    undoRecords_.push_back(UndoRecord{x, false, removedVertices_.size()});
+    auto it = vertices_.lower_bound(x);
+
+    if(it != vertices_.end() && it->first == x) {
+        if(it->second >= y)
+            return;
+        auto next = std::next(it);
+        removeVertex(it);
+        it = next;
+    }
+    else if(it != vertices_.end() && it != vertices_.begin()) {
+        auto prev = std::prev(it);
+        if(cross(prev->first, prev->second, it->first, it->second, x, y) <= 0.0)
+            return;
+    }
+
+    it = vertices_.emplace_hint(it, x, y);
+    undoRecords_.back().bInserted = true;
+
+    auto next = std::next(it);
+    while(next != vertices_.end()) {
+        auto nextNext = std::next(next);
+        if(nextNext == vertices_.end()
+            || cross(x, y, next->first, next->second, nextNext->first, nextNext->second) < 0.0)
+            break;
+        removeVertex(next);
+        next = nextNext;
+    }
+
+    while(it != vertices_.begin()) {
+        auto prev = std::prev(it);
+        if(prev == vertices_.begin())
+            break;
+        auto prevPrev = std::prev(prev);
+        if(cross(prevPrev->first, prevPrev->second, prev->first, prev->second, x, y) < 0.0)
+            break;
+        removeVertex(prev);
+    }
+}
+void UndoableUpperHull2D::undo() {
+    const UndoRecord& record = undoRecords_.back();
+    if(record.bInserted)
+        vertices_.erase(record.x);
+    for(size_t inx = record.inxRemoved; inx < removedVertices_.size(); inx++)
+        vertices_.insert(removedVertices_[inx]);
+    removedVertices_.resize(record.inxRemoved);
+    undoRecords_.pop_back();
+}
+void UndoableUpperHull2D::clear() noexcept {
+    vertices_.clear();
+    undoRecords_.clear();
+    removedVertices_.clear();
+}
+const map<double, double>& UndoableUpperHull2D::getVertices() const noexcept {
+    return vertices_;
+}
+
+// Merges two upper hulls into the upper hull of their union. Both hulls
+// are ordered by the x coordinate, so a merge followed by a monotone chain
+// pass does the job in linear time.
+static void mergeUpperHulls(const map<double, double>& hull1, const map<double, double>& hull2,
+        vector<pair<double, double>>& chain) {
+    chain.clear();
+    auto append = [&chain](double x, double y) {
+        // Of the vertices with the same x coordinate only the top one stays.
+        if(!chain.empty() && chain.back().first == x) {
+            if(chain.back().second >= y)
+                return;
+            chain.pop_back();
+        }
+        while(chain.size() >= 2) {
+            const auto& prev = chain[chain.size() - 1];
+            const auto& prevPrev = chain[chain.size() - 2];
+            if(cross(prevPrev.first, prevPrev.second, prev.first, prev.second, x, y) < 0.0)
+                break;
+            chain.pop_back();
+        }
+        chain.emplace_back(x, y);
+    };
+
+    auto it1 = hull1.begin();
+    auto it2 = hull2.begin();
+    while(it1 != hull1.end() || it2 != hull2.end()) {
+        if(it2 == hull2.end() || (it1 != hull1.end() && it1->first <= it2->first)) {
+            append(it1->first, it1->second);
+            ++it1;
+        }
+        else {
+            append(it2->first, it2->second);
+            ++it2;
+        }
+    }
+}
+
+SlidingWindowHull2D::SlidingWindowHull2D(size_t iWindowSize)
+    : points_(iWindowSize), iWindowSize_{ iWindowSize }, inxOldest_{ 0 }, iCount_{ 0 }, iFrontCount_{ 0 }
+{
+}
+void SlidingWindowHull2D::expireOldest() {
+    if(iFrontCount_ == 0) {
+        // Move the points over to the front hull, the newest one first.
+        frontUpper_.clear();
+        frontLower_.clear();
+        for(size_t inx = iCount_; inx-- > 0; ) {
+            const auto& point = points_[(inxOldest_ + inx) % iWindowSize_];
+            frontUpper_.insert(point.x, point.y);
+            frontLower_.insert(point.x, -point.y);
+        }
+        backUpper_.clear();
+        backLower_.clear();
+        iFrontCount_ = iCount_;
+    }
+    frontUpper_.undo();
+    frontLower_.undo();
+    inxOldest_ = (inxOldest_ + 1) % iWindowSize_;
+    iCount_--;
+    iFrontCount_--;
+}
+void SlidingWindowHull2D::push(double x, double y) {
+    if(iWindowSize_ == 0)
+        return;
+    if(iCount_ == iWindowSize_)
+        expireOldest();
+    auto& point = points_[(inxOldest_ + iCount_) % iWindowSize_];
+    point.x = x;
+    point.y = y;
+    iCount_++;
+    backUpper_.insert(x, y);
+    backLower_.insert(x, -y);
+}
+void SlidingWindowHull2D::clear() noexcept {
+    inxOldest_ = iCount_ = iFrontCount_ = 0;
+    frontUpper_.clear();
+    frontLower_.clear();
+    backUpper_.clear();
+    backLower_.clear();
+}
+size_t SlidingWindowHull2D::getHull(BasicDataPoint2D<double>* convexHull2D, size_t hullCapacity) {
+    if(iCount_ == 0)
+        return 0;
+    mergeUpperHulls(frontUpper_.getVertices(), backUpper_.getVertices(), upperChain_);
+    mergeUpperHulls(frontLower_.getVertices(), backLower_.getVertices(), lowerChain_);
+
+    // Same as IncrementalHull2D::getHull: walk the lower hull from left to
+    // right, then the upper hull from right to left.
+    size_t nPoints {0};
+    BasicDataPoint2D<double> point;
+    auto writePoint = [convexHull2D, hullCapacity, &nPoints, &point]() {
+        if(nPoints < hullCapacity)
+            convexHull2D[nPoints] = point;
+        nPoints++;
+    };
+    auto appendPoint = [&writePoint, &nPoints, &point](double x, double y) {
+        if(nPoints > 0 && point.x == x && point.y == y)
+            return;
+        point.x = x;
+        point.y = y;
+        writePoint();
+    };
+    for(const auto& vertex : lowerChain_)
+        appendPoint(vertex.first, -vertex.second);
+    for(auto it = upperChain_.rbegin(); it != upperChain_.rend(); ++it)
+        appendPoint(it->first, it->second);
+
+    // Close the line loop.
+    const auto& first = lowerChain_.front();
+    if(nPoints > 1 && point.x == first.first && point.y == -first.second)
+        return nPoints;
+    point.x = first.first;
+    point.y = -first.second;
+    writePoint();
+    return nPoints;
+}
+size_t SlidingWindowHull2D::size() const noexcept {
+    return iCount_;
+}
+size_t SlidingWindowHull2D::getWindowSize() const noexcept {
+    return iWindowSize_;
+}
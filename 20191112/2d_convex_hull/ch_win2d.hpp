@@ -0,0 +1,103 @@
+/* ch_win2d.hpp
+This module declares the sliding window 2D Convex Hull engine that maintains
+the hull of the most recent points of a stream.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+*/
+
+#ifndef ch_win2d_hpp
+#define ch_win2d_hpp
+
+#include <map>
+#include <utility>
+#include <vector>
+#include "ch_lib2d.hpp"
+
+namespace dk {
+
+    // An upper hull kept in a map ordered by the x coordinate, the same as
+    // UpperHull2D, that can undo its insertions in the reverse order. Every
+    // insertion logs the vertices it removes, so undoing it costs as much
+    // as the insertion did.
+    class UndoableUpperHull2D {
+    public:
+        void insert(double x, double y);
+        // Undoes the most recent insertion that hasn't been undone yet.
+        void undo();
+        void clear() noexcept;
+        const std::map<double, double>& getVertices() const noexcept;
+
+    private:
+        struct UndoRecord {
+            // The x coordinate of the new vertex, if any.
+            double x;
+            bool bInserted;
+            // The position of the first vertex removed by the insertion
+            // in removedVertices_.
+            size_t inxRemoved;
+        };
+
+        void removeVertex(std::map<double, double>::iterator it);
+
+        std::map<double, double> vertices_;
+        std::vector<UndoRecord> undoRecords_;
+        std::vector<std::pair<double, double>> removedVertices_;
+    };
+
+    // The SlidingWindowHull2D class maintains the convex hull of the last
+    // iWindowSize points pushed into it. When the window is full the oldest
+    // point expires as a new one arrives.
+    //
+    // The window is a queue made of two stacks of hulls. New points are
+    // inserted into the back hull. The front hull holds the older points
+    // and expires them by undoing their insertions: when it runs out of
+    // points, the points of the back hull are moved over to it in the
+    // reverse order of arrival, so the oldest point is always the most
+    // recent insertion. A point is inserted twice and undone once, which
+    // costs O(log h) amortised time where h is the size of the hulls. The
+    // hull of the window is the hull of the vertices of the two hulls,
+    // which are merged in O(h) time.
+    class CH2D_API SlidingWindowHull2D {
+    public:
+        explicit SlidingWindowHull2D(size_t iWindowSize);
+
+        void push(double x, double y);
+        void clear() noexcept;
+
+        // Writes a closed counter-clockwise line loop of the hull of the
+        // window to the buffer in the same format as calcConvexHull2D_mc.
+        // Returns the number of points in the loop. If it exceeds
+        // hullCapacity then only the first hullCapacity points are written,
+        // so the caller can retry with a bigger buffer.
+        size_t getHull(BasicDataPoint2D<double>* convexHull2D, size_t hullCapacity);
+
+        // The number of points in the window.
+        size_t size() const noexcept;
+        size_t getWindowSize() const noexcept;
+
+    private:
+        void expireOldest();
+
+        std::vector<BasicDataPoint2D<double>> points_;
+        size_t iWindowSize_;
+        // The points are kept in a ring buffer. The oldest iFrontCount_
+        // points belong to the front hull.
+        size_t inxOldest_;
+        size_t iCount_;
+        size_t iFrontCount_;
+        // The lower hulls are kept reflected about the x axis.
+        UndoableUpperHull2D frontUpper_;
+        UndoableUpperHull2D frontLower_;
+        UndoableUpperHull2D backUpper_;
+        UndoableUpperHull2D backLower_;
+        // The merged halves of the hull of the window.
+        std::vector<std::pair<double, double>> upperChain_;
+        std::vector<std::pair<double, double>> lowerChain_;
+    };
+
+};   // namespace dk
+
+#endif // ch_win2d_hpp
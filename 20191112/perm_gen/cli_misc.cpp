@@ -5,6 +5,7 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     10/May/2019 - David Krikheli created the module.
+    17/Oct/2026 - Included <memory> for std::make_unique.
 */
 
 #ifdef _CONSOLE
@@ -17,6 +18,7 @@ Modification history:
 #include <sstream>
 #include <iostream>
 #include <locale>
+#include <memory>
 #include "cli_misc.hpp"
 
 using namespace std;
@@ -5,6 +5,11 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     12/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the Heap's algorithm generator.
+    17/Oct/2026 - Added the generator overloads that take a consumer callable.
+    17/Oct/2026 - Added the prefix generator.
+    17/Oct/2026 - Added the permutation ranking functions.
+    17/Oct/2026 - Hold the sequences in std::vector<T>. Added the indexed generator.
 */
 
 #ifndef perm_gen_base_hpp
@@ -16,7 +21,10 @@ Modification history:
 namespace dk {
 
 	// The class template provides a generic permutation engine that can
-	// process sequences of arbitrary trivial types. Populate std::vector<T>
+	// process sequences of arbitrary copyable types. The elements are
+	// compared with operator==, and with operator< by the lexicographic
+	// generator. The engine copies the elements every time it moves them, so
+	// use IndexedPermutationGenerator<T> for large elements. Populate std::vector<T>
 	// with the input sequence and pass it into the generate(....) function to
 	// start generating permutations of the sequence. Every time the engine
 	// generates a new permutation it passes the permutation into the 
@@ -67,9 +75,111 @@ namespace dk {
 		// Set the bForward parameter to 'false' to move backward towards the start.
 		void generate_l(const std::vector<T>&, bool bForward);
 
+		// Executes the minimal change permutation generator.
+		// This function is similar to generate(....). The difference is it
+		// implements B. R. Heap's algorithm: each subsequent permutation is
+		// derived from the previous one by swapping a single pair of symbols.
+		// The algorithm is iterative. It keeps a counter per position instead
+		// of a recursion stack and it doesn't insert or erase any symbols, so
+		// each permutation costs amortised O(1) time and no allocations. The
+		// permutations are not arranged in any particular order.
+		// The function generates duplicate permutations if the input sequence
+		// contains duplicate symbols.
+		void generate_h(const std::vector<T>&);
+
+		// Executes the default permutation generator on a subset of the
+		// permutations. This function delivers the same permutations in the
+		// same order as generate(....) with no randomisation does, but only
+		// those that start with the specified prefix. The prefix is a sequence
+		// of positions in the pool of the remaining input symbols: the first
+		// one selects the first symbol of the permutation from the input
+		// sequence, the second one selects the second symbol from the
+		// remaining symbols and so on. In other words it is the leading digits
+		// of the Lehmer code of the permutations. The generate(....) function
+		// delivers permutations in the lexicographic order of their Lehmer
+		// codes, so splitting the codes into prefixes splits the sequence of
+		// permutations into consecutive ranges that can be generated
+		// independently, e.g. on multiple threads.
+		//
+		// With duplicate permutations excluded the prefix must not select a
+		// symbol that has an equal symbol ahead of it in the pool, because
+		// generate(....) never selects such symbols.
+		void generate_p(const std::vector<T>&, bool bExcludeDups, const std::vector<size_t>& prefix);
+
+		// Executes the default permutation generator starting at the
+		// permutation of the specified rank. This function delivers the same
+		// permutations in the same order as generate(....) with no
+		// randomisation does, except the first iRank ones. The skipped
+		// permutations are not generated: unrankCode(....) locates the first
+		// permutation to deliver and the generator resumes from there. Does
+		// nothing if there are no more than iRank permutations.
+		void generate_r(const std::vector<T>&, bool bExcludeDups, size_t iRank);
+
+		// The following overloads are equivalent to the ones above except
+		// that they deliver the permutations to the consumer callable rather
+		// than to the process_(....) virtual function. The consumer is a
+		// template parameter, so the compiler can inline it into the loop of
+		// the permutation engine, which saves an indirect call per
+		// permutation. The consumer is invoked with a const reference to the
+		// current permutation and can stop the engine by throwing an exception
+		// in the same way process_(....) does. Use PermutationGenerator<T> if
+		// there is no need for a derived class.
+		template <class Consumer>
+		void generate(const std::vector<T>&, bool, size_t, Consumer&& consumer);
+		template <class Consumer>
+		void generate_l(const std::vector<T>&, bool bForward, Consumer&& consumer);
+		template <class Consumer>
+		void generate_h(const std::vector<T>&, Consumer&& consumer);
+		template <class Consumer>
+		void generate_p(const std::vector<T>&, bool bExcludeDups, const std::vector<size_t>& prefix, Consumer&& consumer);
+		template <class Consumer>
+		void generate_r(const std::vector<T>&, bool bExcludeDups, size_t iRank, Consumer&& consumer);
+
+		// The following functions map the permutations to their ranks and
+		// back. The rank of a permutation is its 0 based position in the
+		// sequence generate(....) delivers with no randomisation. It is the
+		// value of the Lehmer code of the permutation in the factorial number
+		// system, in which every digit is weighed by the number of the
+		// permutations of the symbols that remain after it. With duplicate
+		// permutations excluded the weights are the numbers of the distinct
+		// permutations of the remaining symbols, i.e. multinomial
+		// coefficients, so the ranks stay consecutive. The functions don't
+		// generate any permutations: their cost depends on the length of the
+		// sequence only, not on the rank.
+
+		// Returns the number of the permutations of the sequence, not counting
+		// the duplicate permutations if so requested, or SIZE_MAX if the number
+		// doesn't fit into size_t.
+		static size_t countPermutations(const std::vector<T>&, bool bExcludeDups);
+
+		// Calculates the Lehmer code of the permutation of the specified rank
+		// in the form generate_p(....) takes its prefix in. Returns false if
+		// there is no such permutation.
+		static bool unrankCode(const std::vector<T>&, bool bExcludeDups, size_t iRank, std::vector<size_t>& code);
+
+		// Calculates the permutation of the specified rank. Returns false if
+		// there is no such permutation.
+		static bool unrank(const std::vector<T>&, bool bExcludeDups, size_t iRank, std::vector<T>& permutation);
+
+		// Calculates the rank of the permutation. The equal symbols of the
+		// sequence are indistinguishable, so with duplicate permutations
+		// allowed this is the smallest of the ranks of the permutation.
+		// Returns false if the permutation is not a permutation of the
+		// sequence or its rank doesn't fit into size_t.
+		static bool rank(const std::vector<T>&, bool bExcludeDups, const std::vector<T>& permutation, size_t& iRank);
+
 	private:
-		void generate_(size_t);
-		void generate_R2_R3_(size_t);
+		template <class Consumer>
+		void generate_(size_t, Consumer& consumer);
+		template <class Consumer>
+		void generate_r_(size_t, const std::vector<size_t>& code, Consumer& consumer);
+
+		// Returns the number of the permutations of the sequence that start
+		// with the symbol at the specified position given iCount, the number
+		// of all the permutations of the sequence.
+		static size_t countPermutations_(const std::vector<T>&, bool bExcludeDups, size_t iCount, size_t inx);
+		template <class Consumer>
+		void generate_R2_R3_(size_t, Consumer& consumer);
 
 		// The permutation engine delivers permutations through this function.
 		// Every time a new permutation is generated it is passed into this
@@ -90,10 +200,10 @@ namespace dk {
 		virtual void process_(const std::vector<T>&) = 0;
 
 		// Holds the current permutation.
-		std::vector<char> permutation_;
+		std::vector<T> permutation_;
 
 		// Holds the sequence of input symbols to generate permutations of.
-		std::vector<char> symbolPool_;
+		std::vector<T> symbolPool_;
 
 		bool bExcludeDups_;
 		bool bRandom_;
@@ -102,6 +212,78 @@ namespace dk {
 		// Random number generator.
 		std::mt19937_64 _randNumGen;
 	};
+
+	// A permutation generator for the overloads of the generate functions
+	// that take a consumer callable. The permutations are not delivered to
+	// the process_(....) function, so it does nothing.
+	template <class T>
+	class PermutationGenerator final : public PermutationGeneratorBase<T> {
+	private:
+		virtual void process_(const std::vector<T>&) override {}
+	};
+
+	// Refers to an element of a sequence. The references compare the way
+	// the elements they refer to do, so the permutation engines treat a
+	// sequence of references the way they treat the sequence of elements.
+	template <class T>
+	class ElementRef {
+	public:
+		explicit ElementRef(const T& element) noexcept;
+		const T& get() const noexcept;
+		bool operator==(const ElementRef& other) const;
+		bool operator<(const ElementRef& other) const;
+
+	private:
+		const T* pElement_;
+	};
+
+	// A permutation delivered by IndexedPermutationGenerator<T>. It holds
+	// references to the elements of the input sequence rather than copies of
+	// them, so an element is only read when the consumer accesses it. The
+	// view is only valid until the consumer returns.
+	template <class T>
+	class IndexedPermutation {
+	public:
+		IndexedPermutation(const std::vector<ElementRef<T>>& permutation, const T* pFirstElement) noexcept;
+		size_t size() const noexcept;
+		const T& operator[](size_t inx) const noexcept;
+		// Returns the position in the input sequence of the element at the
+		// specified position of the permutation.
+		size_t index(size_t inx) const noexcept;
+		// Copies the elements of the permutation into the vector.
+		void gather(std::vector<T>& permutation) const;
+
+	private:
+		const std::vector<ElementRef<T>>& permutation_;
+		const T* pFirstElement_;
+	};
+
+	// A permutation generator for large elements. It delivers the same
+	// permutations in the same order as the functions of
+	// PermutationGeneratorBase<T> with the same names do. The difference is
+	// the permutation engine moves pointer sized references to the elements
+	// rather than the elements themselves, and the permutations are
+	// delivered to the consumer callable as IndexedPermutation<T> views. The
+	// input sequence must not change while the generator is running.
+	template <class T>
+	class IndexedPermutationGenerator {
+	public:
+		template <class Consumer>
+		void generate(const std::vector<T>&, bool, size_t, Consumer&& consumer);
+		template <class Consumer>
+		void generate_l(const std::vector<T>&, bool bForward, Consumer&& consumer);
+		template <class Consumer>
+		void generate_h(const std::vector<T>&, Consumer&& consumer);
+		template <class Consumer>
+		void generate_p(const std::vector<T>&, bool bExcludeDups, const std::vector<size_t>& prefix, Consumer&& consumer);
+		template <class Consumer>
+		void generate_r(const std::vector<T>&, bool bExcludeDups, size_t iRank, Consumer&& consumer);
+
+	private:
+		static std::vector<ElementRef<T>> makeRefs_(const std::vector<T>&);
+
+		PermutationGenerator<ElementRef<T>> generator_;
+	};
 };  // namespace dk
 
 #include "perm_gen_base.inl"
@@ -5,9 +5,17 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     14/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the Heap's algorithm generator.
+    17/Oct/2026 - Added the generator overloads that take a consumer callable.
+    17/Oct/2026 - Added the prefix generator.
+    17/Oct/2026 - Added the permutation ranking functions.
+    17/Oct/2026 - Hold the sequences in std::vector<T>. Added the indexed generator.
 */
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
 
 namespace dk {
 
@@ -28,31 +36,60 @@ namespace dk {
 	}
 	template <class T>
 	void PermutationGeneratorBase<T>::generate(const std::vector<T>& symbolPool, bool bExcludeDups, size_t iRandPermAlgId) {
-		permutation_.resize(symbolPool.size());
+		generate(symbolPool, bExcludeDups, iRandPermAlgId,
+			[this](const std::vector<T>& permutation) { process_(permutation); });
+	}
+	template <class T>
+	void PermutationGeneratorBase<T>::generate_l(const std::vector<T>& symbolPool, bool bAscending) {
+		generate_l(symbolPool, bAscending,
+			[this](const std::vector<T>& permutation) { process_(permutation); });
+	}
+	template <class T>
+	void PermutationGeneratorBase<T>::generate_h(const std::vector<T>& symbolPool) {
+		generate_h(symbolPool,
+			[this](const std::vector<T>& permutation) { process_(permutation); });
+	}
+	template <class T>
+	void PermutationGeneratorBase<T>::generate_p(const std::vector<T>& symbolPool, bool bExcludeDups,
+		const std::vector<size_t>& prefix) {
+		generate_p(symbolPool, bExcludeDups, prefix,
+			[this](const std::vector<T>& permutation) { process_(permutation); });
+	}
+	template <class T>
+	void PermutationGeneratorBase<T>::generate_r(const std::vector<T>& symbolPool, bool bExcludeDups, size_t iRank) {
+		generate_r(symbolPool, bExcludeDups, iRank,
+			[this](const std::vector<T>& permutation) { process_(permutation); });
+	}
+	template <class T>
+	template <class Consumer>
+	void PermutationGeneratorBase<T>::generate(const std::vector<T>& symbolPool, bool bExcludeDups, size_t iRandPermAlgId,
+		Consumer&& consumer) {
+		permutation_ = symbolPool;
 		symbolPool_ = symbolPool;
 		switch (iRandPermAlgId) {
 		case 0:
 			bExcludeDups_ = bExcludeDups;
 			bRandom_ = false;
-			generate_(0);
+			generate_(0, consumer);
 			break;
 		case 1:
 			bExcludeDups_ = bExcludeDups;
 			bRandom_ = true;
-			generate_(0);
+			generate_(0, consumer);
 			break;
 		case 2:
 			// bExcludeDups_ and bRandom_ have no effect on generate_R2_R3_(....).
-			generate_R2_R3_(0);
+			generate_R2_R3_(0, consumer);
 			break;
 		case 3:
 			// bExcludeDups_ and bRandom_ have no effect on generate_R2_R3_(....).
-			generate_R2_R3_(1);
+			generate_R2_R3_(1, consumer);
 			break;
 		}
 	}
 	template <class T>
-	void PermutationGeneratorBase<T>::generate_(size_t iPos) {
+	template <class Consumer>
+	void PermutationGeneratorBase<T>::generate_(size_t iPos, Consumer& consumer) {
 		size_t vocSize = symbolPool_.size();
 
 		std::uniform_int_distribution<size_t> dist(0, vocSize-1);
@@ -78,11 +115,11 @@ namespace dk {
 			// process the permutation and move on to the next recursion cycle.
 			// Otherwise just keep drilling down.
 			if (vocSize == 1)
-				process_(permutation_);
+				consumer(permutation_);
 			else
 			{
 				symbolPool_.erase(symbolPool_.begin() + inx);
-				generate_(iPos + 1);
+				generate_(iPos + 1, consumer);
 				symbolPool_.insert(symbolPool_.begin() + inx, permutation_[iPos]);
 
 				// The following piece of code ran perfectly ok when compiled with clang++
@@ -97,18 +134,238 @@ namespace dk {
 		}
 	}
 	template <class T>
-	void PermutationGeneratorBase<T>::generate_l(const std::vector<T>& symbolPool, bool bAscending) {
+	template <class Consumer>
+	void PermutationGeneratorBase<T>::generate_l(const std::vector<T>& symbolPool, bool bAscending, Consumer&& consumer) {
 		permutation_ = symbolPool;
 
 		if (bAscending)
-			do process_(permutation_);
+			do consumer(permutation_);
 			while (std::next_permutation(permutation_.begin(), permutation_.end()));
 		else
-			do process_(permutation_);
+			do consumer(permutation_);
 			while (std::prev_permutation(permutation_.begin(), permutation_.end()));
 	}
 	template <class T>
-	void PermutationGeneratorBase<T>::generate_R2_R3_(size_t iOffset) {
+	template <class Consumer>
+	void PermutationGeneratorBase<T>::generate_h(const std::vector<T>& symbolPool, Consumer&& consumer) {
+		permutation_ = symbolPool;
+		size_t vocSize = permutation_.size();
+		if (vocSize == 0)
+			return;
+
+		// Counter i emulates the loop variable of the recursive formulation
+		// at the level that permutes the first i + 1 symbols.
+		std::vector<size_t> counters(vocSize, 0);
+		consumer(permutation_);
+
+		size_t i{ 1 };
+		while (i < vocSize) {
+			if (counters[i] < i) {
+				if (i % 2 == 0)
+					std::swap(permutation_[0], permutation_[i]);
+				else
+					std::swap(permutation_[counters[i]], permutation_[i]);
+				consumer(permutation_);
+				counters[i]++;
+				i = 1;
+			}
+			else {
+				counters[i] = 0;
+				i++;
+			}
+		}
+	}
+	template <class T>
+	template <class Consumer>
+	void PermutationGeneratorBase<T>::generate_p(const std::vector<T>& symbolPool, bool bExcludeDups,
+		const std::vector<size_t>& prefix, Consumer&& consumer) {
+		if (symbolPool.empty())
+			return;
+		permutation_ = symbolPool;
+		symbolPool_ = symbolPool;
+		bExcludeDups_ = bExcludeDups;
+		bRandom_ = false;
+
+		// Replay the choices of the upper levels of the recursion tree.
+		size_t iPos{ 0 };
+		for (; iPos < prefix.size(); iPos++) {
+			permutation_[iPos] = symbolPool_[prefix[iPos]];
+			symbolPool_.erase(symbolPool_.begin() + prefix[iPos]);
+		}
+
+		if (symbolPool_.empty())
+			consumer(permutation_);
+		else
+			generate_(iPos, consumer);
+	}
+	template <class T>
+	template <class Consumer>
+	void PermutationGeneratorBase<T>::generate_r(const std::vector<T>& symbolPool, bool bExcludeDups, size_t iRank,
+		Consumer&& consumer) {
+		std::vector<size_t> code;
+		if (!unrankCode(symbolPool, bExcludeDups, iRank, code))
+			return;
+		permutation_ = symbolPool;
+		symbolPool_ = symbolPool;
+		bExcludeDups_ = bExcludeDups;
+		bRandom_ = false;
+		generate_r_(0, code, consumer);
+	}
+	template <class T>
+	template <class Consumer>
+	void PermutationGeneratorBase<T>::generate_r_(size_t iPos, const std::vector<size_t>& code, Consumer& consumer) {
+		// Follow the path of the first permutation down the recursion tree.
+		// The siblings that come after the path on each level are generated
+		// in full.
+		for (size_t inx = code[iPos]; inx < symbolPool_.size(); inx++) {
+			if (bExcludeDups_) {
+				auto it = symbolPool_.begin() + inx;
+				if (std::find(symbolPool_.begin(), it, *it) != it)
+					continue;
+			}
+
+			permutation_[iPos] = symbolPool_[inx];
+			if (symbolPool_.size() == 1)
+				consumer(permutation_);
+			else {
+				symbolPool_.erase(symbolPool_.begin() + inx);
+				if (inx == code[iPos])
+					generate_r_(iPos + 1, code, consumer);
+				else
+					generate_(iPos + 1, consumer);
+				symbolPool_.insert(symbolPool_.begin() + inx, permutation_[iPos]);
+			}
+		}
+	}
+	template <class T>
+	size_t PermutationGeneratorBase<T>::countPermutations(const std::vector<T>& symbolPool, bool bExcludeDups) {
+		// After every step iCount holds the number of the permutations of the
+		// first inx + 1 symbols: the previous number times inx + 1 divided by
+		// the number of the copies of the new symbol if duplicates are
+		// excluded.
+		size_t iCount{ 1 };
+		for (size_t inx = 0; inx < symbolPool.size(); inx++) {
+			size_t iFactor{ inx + 1 };
+			size_t iCopies{ 1 };
+			if (bExcludeDups)
+				iCopies = size_t(std::count(symbolPool.begin(), symbolPool.begin() + inx + 1, symbolPool[inx]));
+
+			// The division is exact, so iCopies divides the product. Cancel
+			// the common factor first to avoid a premature overflow.
+			size_t iGcd = std::gcd(iFactor, iCopies);
+			iFactor /= iGcd;
+			iCount /= iCopies / iGcd;
+			if (iCount > SIZE_MAX / iFactor)
+				return SIZE_MAX;
+			iCount *= iFactor;
+		}
+		return iCount;
+	}
+	template <class T>
+	size_t PermutationGeneratorBase<T>::countPermutations_(const std::vector<T>& symbolPool, bool bExcludeDups,
+		size_t iCount, size_t inx) {
+		if (iCount == SIZE_MAX) {
+			// The number of all the permutations is unknown. Count directly.
+			std::vector<T> remainingSymbols(symbolPool);
+			remainingSymbols.erase(remainingSymbols.begin() + inx);
+			return countPermutations(remainingSymbols, bExcludeDups);
+		}
+
+		// Out of the permutations of the n symbols the share of those that
+		// start with the symbol is the number of its copies divided by n.
+		size_t iSize{ symbolPool.size() };
+		size_t iCopies{ 1 };
+		if (bExcludeDups)
+			iCopies = size_t(std::count(symbolPool.begin(), symbolPool.end(), symbolPool[inx]));
+		size_t iGcd = std::gcd(iSize, iCopies);
+		return iCount / (iSize / iGcd) * (iCopies / iGcd);
+	}
+	template <class T>
+	bool PermutationGeneratorBase<T>::unrankCode(const std::vector<T>& symbolPool, bool bExcludeDups, size_t iRank,
+		std::vector<size_t>& code) {
+		code.clear();
+		size_t iCount = countPermutations(symbolPool, bExcludeDups);
+		// SIZE_MAX is not a valid rank even if there are more permutations.
+		if (symbolPool.empty() || iRank >= iCount)
+			return false;
+
+		std::vector<T> remainingSymbols(symbolPool);
+		while (remainingSymbols.size()) {
+			size_t inx{ 0 };
+			size_t iSubCount{ 0 };
+			if (!bExcludeDups) {
+				// All the symbols start equal numbers of permutations.
+				iSubCount = countPermutations_(remainingSymbols, false, iCount, 0);
+				inx = iRank / iSubCount;
+				iRank %= iSubCount;
+			}
+			else
+				for (; inx < remainingSymbols.size(); inx++) {
+					auto it = remainingSymbols.begin() + inx;
+					if (std::find(remainingSymbols.begin(), it, *it) != it)
+						continue;
+					iSubCount = countPermutations_(remainingSymbols, true, iCount, inx);
+					if (iRank < iSubCount)
+						break;
+					iRank -= iSubCount;
+				}
+
+			code.push_back(inx);
+			remainingSymbols.erase(remainingSymbols.begin() + inx);
+			iCount = iSubCount;
+		}
+		return true;
+	}
+	template <class T>
+	bool PermutationGeneratorBase<T>::unrank(const std::vector<T>& symbolPool, bool bExcludeDups, size_t iRank,
+		std::vector<T>& permutation) {
+		std::vector<size_t> code;
+		if (!unrankCode(symbolPool, bExcludeDups, iRank, code))
+			return false;
+
+		std::vector<T> remainingSymbols(symbolPool);
+		permutation.clear();
+		for (size_t inx : code) {
+			permutation.push_back(remainingSymbols[inx]);
+			remainingSymbols.erase(remainingSymbols.begin() + inx);
+		}
+		return true;
+	}
+	template <class T>
+	bool PermutationGeneratorBase<T>::rank(const std::vector<T>& symbolPool, bool bExcludeDups,
+		const std::vector<T>& permutation, size_t& iRank) {
+		if (symbolPool.empty() || permutation.size() != symbolPool.size())
+			return false;
+
+		std::vector<T> remainingSymbols(symbolPool);
+		size_t iCount = countPermutations(symbolPool, bExcludeDups);
+		iRank = 0;
+		for (const T& symbol : permutation) {
+			// The generator picks the first one of the equal symbols.
+			auto itSymbol = std::find(remainingSymbols.begin(), remainingSymbols.end(), symbol);
+			if (itSymbol == remainingSymbols.end())
+				return false;
+			size_t inxSymbol = size_t(itSymbol - remainingSymbols.begin());
+
+			// Add up the permutations that start with the preceding symbols.
+			for (size_t inx = 0; inx < inxSymbol; inx++) {
+				auto it = remainingSymbols.begin() + inx;
+				if (bExcludeDups && std::find(remainingSymbols.begin(), it, *it) != it)
+					continue;
+				size_t iSubCount = countPermutations_(remainingSymbols, bExcludeDups, iCount, inx);
+				if (iSubCount >= SIZE_MAX - iRank)
+					return false;
+				iRank += iSubCount;
+			}
+
+			iCount = countPermutations_(remainingSymbols, bExcludeDups, iCount, inxSymbol);
+			remainingSymbols.erase(itSymbol);
+		}
+		return true;
+	}
+	template <class T>
+	template <class Consumer>
+	void PermutationGeneratorBase<T>::generate_R2_R3_(size_t iOffset, Consumer& consumer) {
 		size_t vocSize = symbolPool_.size();
 		permutation_ = symbolPool_;
 		size_t j{ 0 };
@@ -118,7 +375,106 @@ namespace dk {
 				j = dist(_randNumGen);
 				iter_swap(permutation_.begin() + i, permutation_.begin() + j);
 			}
-			process_(permutation_);
+			consumer(permutation_);
 		}
 	}
+
+	template <class T>
+	ElementRef<T>::ElementRef(const T& element) noexcept
+		: pElement_{ &element } {
+	}
+	template <class T>
+	const T& ElementRef<T>::get() const noexcept {
+		return *pElement_;
+	}
+	template <class T>
+	bool ElementRef<T>::operator==(const ElementRef& other) const {
+		return *pElement_ == *other.pElement_;
+	}
+	template <class T>
+	bool ElementRef<T>::operator<(const ElementRef& other) const {
+		return *pElement_ < *other.pElement_;
+	}
+
+	template <class T>
+	IndexedPermutation<T>::IndexedPermutation(const std::vector<ElementRef<T>>& permutation,
+		const T* pFirstElement) noexcept
+		: permutation_{ permutation }, pFirstElement_{ pFirstElement } {
+	}
+	template <class T>
+	size_t IndexedPermutation<T>::size() const noexcept {
+		return permutation_.size();
+	}
+	template <class T>
+	const T& IndexedPermutation<T>::operator[](size_t inx) const noexcept {
+		return permutation_[inx].get();
+	}
+	template <class T>
+	size_t IndexedPermutation<T>::index(size_t inx) const noexcept {
+		return size_t(&permutation_[inx].get() - pFirstElement_);
+	}
+	template <class T>
+	void IndexedPermutation<T>::gather(std::vector<T>& permutation) const {
+		permutation.clear();
+		for (const auto& ref : permutation_)
+			permutation.push_back(ref.get());
+	}
+
+	template <class T>
+	std::vector<ElementRef<T>> IndexedPermutationGenerator<T>::makeRefs_(const std::vector<T>& symbolPool) {
+		std::vector<ElementRef<T>> refs;
+		refs.reserve(symbolPool.size());
+		for (const T& symbol : symbolPool)
+			refs.emplace_back(symbol);
+		return refs;
+	}
+	template <class T>
+	template <class Consumer>
+	void IndexedPermutationGenerator<T>::generate(const std::vector<T>& symbolPool, bool bExcludeDups,
+		size_t iRandPermAlgId, Consumer&& consumer) {
+		const T* pFirstElement = symbolPool.data();
+		generator_.generate(makeRefs_(symbolPool), bExcludeDups, iRandPermAlgId,
+			[&consumer, pFirstElement](const std::vector<ElementRef<T>>& permutation) {
+				consumer(IndexedPermutation<T>(permutation, pFirstElement));
+			});
+	}
+	template <class T>
+	template <class Consumer>
+	void IndexedPermutationGenerator<T>::generate_l(const std::vector<T>& symbolPool, bool bAscending,
+		Consumer&& consumer) {
+		const T* pFirstElement = symbolPool.data();
+		generator_.generate_l(makeRefs_(symbolPool), bAscending,
+			[&consumer, pFirstElement](const std::vector<ElementRef<T>>& permutation) {
+				consumer(IndexedPermutation<T>(permutation, pFirstElement));
+			});
+	}
+	template <class T>
+	template <class Consumer>
+	void IndexedPermutationGenerator<T>::generate_h(const std::vector<T>& symbolPool, Consumer&& consumer) {
+		const T* pFirstElement = symbolPool.data();
+		generator_.generate_h(makeRefs_(symbolPool),
+			[&consumer, pFirstElement](const std::vector<ElementRef<T>>& permutation) {
+				consumer(IndexedPermutation<T>(permutation, pFirstElement));
+			});
+	}
+	template <class T>
+	template <class Consumer>
+	void IndexedPermutationGenerator<T>::generate_p(const std::vector<T>& symbolPool, bool bExcludeDups,
+		const std::vector<size_t>& prefix, Consumer&& consumer) {
+		const T* pFirstElement = symbolPool.data();
+		generator_.generate_p(makeRefs_(symbolPool), bExcludeDups, prefix,
+			[&consumer, pFirstElement](const std::vector<ElementRef<T>>& permutation) {
+				consumer(IndexedPermutation<T>(permutation, pFirstElement));
+			});
+	}
+	template <class T>
+	template <class Consumer>
+	void IndexedPermutationGenerator<T>::generate_r(const std::vector<T>& symbolPool, bool bExcludeDups,
+		size_t iRank, Consumer&& consumer) {
+		const T* pFirstElement = symbolPool.data();
+		generator_.generate_r(makeRefs_(symbolPool), bExcludeDups, iRank,
+			[&consumer, pFirstElement](const std::vector<ElementRef<T>>& permutation) {
+				consumer(IndexedPermutation<T>(permutation, pFirstElement));
+			});
+	}
 };  // namespace dk
@@ -0,0 +1,233 @@
+/* perm_gen_bench_main.cpp
+The main entry point of the permutation generator benchmark. Times the
+permutation engines delivering the permutations through the process_(....)
+virtual function and through an inlined consumer callable, and permuting
+large elements directly and through the indexed generator.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Added the large element benchmark.
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "perm_gen_base.hpp"
+
+using namespace std;
+using namespace dk;
+
+// The work done per permutation. It is cheap on purpose, so the cost of
+// delivering the permutation to the consumer shows. The checksum depends on
+// the permutation, so the compiler can't optimise the generator away.
+struct PermutationChecksum {
+	size_t iCount{ 0 };
+	size_t iChecksum{ 0 };
+
+	inline void update(const vector<char>& permutation) noexcept {
+		iCount++;
+		iChecksum += size_t(permutation.front()) * 7 + size_t(permutation.back());
+	}
+};
+
+// Consumes the permutations through the process_(....) virtual function.
+class VirtualChecksumGenerator : public PermutationGeneratorBase<char> {
+public:
+	PermutationChecksum checksum;
+
+private:
+	virtual void process_(const vector<char>& permutation) override {
+		checksum.update(permutation);
+	}
+};
+
+// The permutation engines available to the benchmark.
+enum class Engine { recursive, lexicographic, heap };
+
+static const char* getEngineName(Engine engine) noexcept {
+	switch (engine) {
+	case Engine::recursive: return "generate";
+	case Engine::lexicographic: return "generate_l";
+	default: return "generate_h";
+	}
+}
+
+// Runs the engine on a generator either with the consumer or, if it is
+// null, through the process_(....) virtual function.
+template <class Generator, class T, class Consumer>
+static void runEngine(Engine engine, Generator& generator, const vector<T>& symbolPool, Consumer* consumer) {
+	if (consumer) {
+		switch (engine) {
+		case Engine::recursive: generator.generate(symbolPool, false, 0, *consumer); break;
+		case Engine::lexicographic: generator.generate_l(symbolPool, true, *consumer); break;
+		case Engine::heap: generator.generate_h(symbolPool, *consumer); break;
+		}
+		return;
+	}
+	switch (engine) {
+	case Engine::recursive: generator.generate(symbolPool, false, 0); break;
+	case Engine::lexicographic: generator.generate_l(symbolPool, true); break;
+	case Engine::heap: generator.generate_h(symbolPool); break;
+	}
+}
+
+static void printResult(Engine engine, const char* dispatch, size_t nSymbols, size_t nIterations,
+		double totalSeconds, size_t iCount) {
+	string benchName = string("BM_") + getEngineName(engine) + '_' + dispatch + '/' + to_string(nSymbols);
+	double seconds = totalSeconds / double(nIterations);
+	double perPermutation = iCount > 0 ? seconds / double(iCount) : 0.0;
+	printf("%-40s %12.3f ns %10zu %14.3f M perms/s\n", benchName.c_str(), perPermutation * 1e9,
+		nIterations, perPermutation > 0.0 ? 1e-6 / perPermutation : 0.0);
+}
+
+// Times the engine with both kinds of consumers. Returns false if they
+// don't deliver the same permutations.
+static bool runBenchmark(Engine engine, size_t nSymbols, size_t nIterations) {
+	vector<char> symbolPool(nSymbols);
+	for (size_t inx = 0; inx < nSymbols; inx++)
+		symbolPool[inx] = char('a' + inx);
+
+	using clock = chrono::high_resolution_clock;
+	double virtualSeconds{ 0.0 };
+	double inlinedSeconds{ 0.0 };
+	PermutationChecksum virtualChecksum;
+	PermutationChecksum inlinedChecksum;
+	for (size_t inx = 0; inx < nIterations; inx++) {
+		VirtualChecksumGenerator virtualGenerator;
+		auto start = clock::now();
+		runEngine(engine, virtualGenerator, symbolPool, static_cast<void (*)(const vector<char>&)>(nullptr));
+		auto finish = clock::now();
+		virtualSeconds += chrono::duration<double>(finish - start).count();
+		virtualChecksum = virtualGenerator.checksum;
+
+		PermutationGenerator<char> inlinedGenerator;
+		PermutationChecksum checksum;
+		auto consumer = [&checksum](const vector<char>& permutation) { checksum.update(permutation); };
+		start = clock::now();
+		runEngine(engine, inlinedGenerator, symbolPool, &consumer);
+		finish = clock::now();
+		inlinedSeconds += chrono::duration<double>(finish - start).count();
+		inlinedChecksum = checksum;
+	}
+
+	printResult(engine, "virtual", nSymbols, nIterations, virtualSeconds, virtualChecksum.iCount);
+	printResult(engine, "inlined", nSymbols, nIterations, inlinedSeconds, inlinedChecksum.iCount);
+	bool bPassed = virtualChecksum.iCount == inlinedChecksum.iCount
+		&& virtualChecksum.iChecksum == inlinedChecksum.iChecksum;
+	printf("    consumer check %s, the inlined consumer is %.2f times faster\n",
+		bPassed ? "passed" : "FAILED", inlinedSeconds > 0.0 ? virtualSeconds / inlinedSeconds : 0.0);
+	return bPassed;
+}
+
+// A large element. Only the key takes part in the comparisons.
+struct Payload {
+	size_t iKey;
+	array<char, 248> data;
+
+	bool operator==(const Payload& other) const noexcept { return iKey == other.iKey; }
+	bool operator<(const Payload& other) const noexcept { return iKey < other.iKey; }
+};
+
+// Times the engine permuting large elements with PermutationGenerator<T>,
+// which moves the elements, and with IndexedPermutationGenerator<T>, which
+// moves references to them. Returns false if they don't deliver the same
+// permutations.
+static bool runPayloadBenchmark(Engine engine, size_t nSymbols, size_t nIterations) {
+	vector<Payload> symbolPool(nSymbols);
+	for (size_t inx = 0; inx < nSymbols; inx++)
+		symbolPool[inx].iKey = inx;
+
+	using clock = chrono::high_resolution_clock;
+	double directSeconds{ 0.0 };
+	double indexedSeconds{ 0.0 };
+	PermutationChecksum directChecksum;
+	PermutationChecksum indexedChecksum;
+	for (size_t inx = 0; inx < nIterations; inx++) {
+		PermutationGenerator<Payload> directGenerator;
+		PermutationChecksum checksum;
+		auto directConsumer = [&checksum](const vector<Payload>& permutation) {
+			checksum.iCount++;
+			checksum.iChecksum += permutation.front().iKey * 7 + permutation.back().iKey;
+		};
+		auto start = clock::now();
+		runEngine(engine, directGenerator, symbolPool, &directConsumer);
+		auto finish = clock::now();
+		directSeconds += chrono::duration<double>(finish - start).count();
+		directChecksum = checksum;
+
+		IndexedPermutationGenerator<Payload> indexedGenerator;
+		checksum = PermutationChecksum();
+		auto indexedConsumer = [&checksum](const IndexedPermutation<Payload>& permutation) {
+			checksum.iCount++;
+			checksum.iChecksum += permutation[0].iKey * 7 + permutation[permutation.size() - 1].iKey;
+		};
+		start = clock::now();
+		switch (engine) {
+		case Engine::recursive: indexedGenerator.generate(symbolPool, false, 0, indexedConsumer); break;
+		case Engine::lexicographic: indexedGenerator.generate_l(symbolPool, true, indexedConsumer); break;
+		case Engine::heap: indexedGenerator.generate_h(symbolPool, indexedConsumer); break;
+		}
+		finish = clock::now();
+		indexedSeconds += chrono::duration<double>(finish - start).count();
+		indexedChecksum = checksum;
+	}
+
+	printResult(engine, "direct256", nSymbols, nIterations, directSeconds, directChecksum.iCount);
+	printResult(engine, "indexed256", nSymbols, nIterations, indexedSeconds, indexedChecksum.iCount);
+	bool bPassed = directChecksum.iCount == indexedChecksum.iCount
+		&& directChecksum.iChecksum == indexedChecksum.iChecksum;
+	printf("    element check %s, the indexed generator is %.2f times faster\n",
+		bPassed ? "passed" : "FAILED", indexedSeconds > 0.0 ? directSeconds / indexedSeconds : 0.0);
+	return bPassed;
+}
+
+static void printUsage() noexcept {
+	cout << "Permutation generator benchmark" << '\n';
+	cout << "Copyright (c) 2019 David Krikheli" << '\n';
+	cout << "Usage: perm-gen-bench [options]" << '\n';
+	cout << " -h         - print help info. Same as --help;" << '\n';
+	cout << " -n   count - the number of symbols to permute (1 - 13). Defaults to 10;" << '\n';
+	cout << " -r   rep   - the number of iterations per benchmark. Defaults to 5." << '\n';
+}
+
+int main(int argc, char* argv[]) {
+	size_t nSymbols{ 10 };
+	size_t nIterations{ 5 };
+
+	for (int inx = 1; inx < argc; inx++) {
+		string strArg(argv[inx]);
+		if (strArg == "-h" || strArg == "--help") {
+			printUsage();
+			return 0;
+		}
+		if (inx + 1 == argc || (strArg != "-n" && strArg != "-r")) {
+			cerr << "perm-gen-bench error: unexpected argument " << strArg << '\n';
+			printUsage();
+			return 1;
+		}
+		string strValue(argv[++inx]);
+		size_t iValue = size_t(strtoull(strValue.c_str(), nullptr, 10));
+		if (iValue == 0 || (strArg == "-n" && iValue > 13)) {
+			cerr << "perm-gen-bench error: invalid value " << strValue << " of option " << strArg << '\n';
+			return 1;
+		}
+		if (strArg == "-n")
+			nSymbols = iValue;
+		else
+			nIterations = iValue;
+	}
+
+	printf("%-40s %15s %10s %25s\n", "Benchmark", "Time", "Iterations", "Throughput");
+	bool bPassed{ true };
+	for (auto engine : { Engine::recursive, Engine::lexicographic, Engine::heap })
+		bPassed = runBenchmark(engine, nSymbols, nIterations) && bPassed;
+	for (auto engine : { Engine::recursive, Engine::lexicographic, Engine::heap })
+		bPassed = runPayloadBenchmark(engine, nSymbols, nIterations) && bPassed;
+	return bPassed ? 0 : 2;
+}
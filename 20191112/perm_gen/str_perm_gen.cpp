@@ -5,6 +5,8 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     14/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Filter and print permutations without converting them to strings.
+    17/Oct/2026 - Added the hooks of the parallel generator.
 */
 
 #include <fstream>
@@ -25,7 +27,8 @@ StringPermutationGenerator::StringPermutationGenerator(size_t iStartNum,
 : iStartNum_(iStartNum), iPrintCount_{ iPrintCount }, bPrintNumbers_{ bPrintNumbers },
 outStream_{ outStream }, bUseCLIRegex_{ false }, bExclusionRegex_{ false },
 objRegex_(), iPermutationNumber_{ 0 }, iPrintCounter_{ 0 },
-iGroupSize_{ 0 }, iIntraGroupCounter_{ 0 }, iNextInGroup_{ 0 }, dist_(), bSilent_(false)
+iGroupSize_{ 0 }, iIntraGroupCounter_{ 0 }, iNextInGroup_{ 0 }, dist_(), bSilent_(false),
+iChunkSize_{ 0 }, iChunkCountdown_{ 0 }, chunkCallback_()
 {
 }
 void StringPermutationGenerator::assignRegex(const string& strRegex, bool bExclusionRegex) noexcept {
@@ -46,8 +49,8 @@ void StringPermutationGenerator::setGroupSize(size_t iGroupSize) noexcept {
 void StringPermutationGenerator::setSilent(bool bSilent) noexcept {
 	bSilent_ = bSilent;
 }
-inline bool StringPermutationGenerator::checkWithRegex_(const string& strPermutation) noexcept {
-	bool bMatched = regex_search(strPermutation, objRegex_, regex_constants::match_any);
+inline bool StringPermutationGenerator::checkWithRegex_(const vector<char>& permutation) noexcept {
+	bool bMatched = regex_search(permutation.begin(), permutation.end(), objRegex_, regex_constants::match_any);
 	if (
 		// Inclusion regex was requested and there is a matching permutation.
 		(!bExclusionRegex_ && bMatched)
@@ -75,11 +78,10 @@ void StringPermutationGenerator::process_(const vector<char>& permutation) {
 		throw PermutationGeneratorStopSignal();
 
 	// There are more permutations to print.
-	// Convert the permutation from the generic vector format to string.
-	std::string strPermutation(permutation.begin(), permutation.end());
-
-	// Apply the regex filter if so requested by the user.
-	if (bUseCLIRegex_ && !checkWithRegex_(strPermutation))
+	// Apply the regex filter if so requested by the user. The filter and the
+	// output work on the characters of the permutation directly rather than
+	// on a string copy, which would dominate the cost of the fast generators.
+	if (bUseCLIRegex_ && !checkWithRegex_(permutation))
 		return;
 
 	// Check if the random selection from groups is expected
@@ -103,12 +105,25 @@ void StringPermutationGenerator::process_(const vector<char>& permutation) {
 	// Print at last and remember to update the counter of printed permutations.
 	if (!bSilent_) {
 		if (bPrintNumbers_)
-			outStream_ << iPermutationNumber_ << " " << strPermutation << '\n';
-		else
-			outStream_ << strPermutation << '\n';
+			outStream_ << iPermutationNumber_ << " ";
+		outStream_.write(permutation.data(), permutation.size());
+		outStream_ << '\n';
 	}
 	iPrintCounter_++;
+
+	if (iChunkSize_ && --iChunkCountdown_ == 0) {
+		iChunkCountdown_ = iChunkSize_;
+		chunkCallback_();
+	}
 }
 size_t StringPermutationGenerator::getPermutationCount() noexcept {
 	return iPrintCounter_;
+}
+void StringPermutationGenerator::setPermutationNumber(size_t iPermutationNumber) noexcept {
+	iPermutationNumber_ = iPermutationNumber;
+}
+void StringPermutationGenerator::setChunkCallback(size_t iChunkSize, std::function<void()> chunkCallback) {
+	iChunkSize_ = iChunkSize;
+	iChunkCountdown_ = iChunkSize;
+	chunkCallback_ = chunkCallback;
 }
\ No newline at end of file
@@ -5,6 +5,8 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     14/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Filter and print permutations without converting them to strings.
+    17/Oct/2026 - Added the hooks of the parallel generator.
 */
 
 #ifndef str_perm_gen_hpp
@@ -15,6 +17,7 @@ Modification history:
 #include <vector>
 #include <regex>
 #include <exception>
+#include <functional>
 
 #include "perm_gen_base.hpp"
 
@@ -37,6 +40,15 @@ public:
 	// The count of permutations intended for output.
 	size_t getPermutationCount() noexcept;
 
+	// Sets the number of permutations that precede the first permutation
+	// delivered to this generator. Used when the sequence of permutations is
+	// split into ranges generated by separate generators.
+	void setPermutationNumber(size_t iPermutationNumber) noexcept;
+
+	// Makes the generator call the callback every time it has output another
+	// iChunkSize permutations, e.g. to hand the output over to another thread.
+	void setChunkCallback(size_t iChunkSize, std::function<void()> chunkCallback);
+
 private:
 	// These are copies of the constructor arguments.
 	size_t iStartNum_;
@@ -53,7 +65,7 @@ private:
 	size_t iPermutationNumber_;
 	size_t iPrintCounter_;
 
-	inline bool checkWithRegex_(const std::string& strPermutation) noexcept;
+	inline bool checkWithRegex_(const std::vector<char>& permutation) noexcept;
 	virtual void process_(const std::vector<char>& permutation);
 
 	// These are used for randomly selecting a permutation from each
@@ -64,6 +76,10 @@ private:
 	std::uniform_int_distribution<size_t> dist_;
 
 	bool bSilent_;
+
+	size_t iChunkSize_;
+	size_t iChunkCountdown_;
+	std::function<void()> chunkCallback_;
 };
 
 #endif // str_perm_gen_hpp
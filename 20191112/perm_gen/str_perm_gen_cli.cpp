@@ -5,6 +5,8 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     16/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the Heap's algorithm option.
+    17/Oct/2026 - Added the thread count option.
 */
 
 #include <iostream>
@@ -18,8 +20,8 @@ StrPermGenCLIParser::StrPermGenCLIParser(int argc, char** argv)
 	bPrintNumbers_{ false }, strOutFile_{ "" }, bExclusionRegex_{ false },
 	strRegex_{ "" }, bPresort_{ false }, bPresortAscending_{ false }, 
 	bLexicographicOrder_{ false }, bLexOrderAscending_{ false },
-	bExcludeDups_{ false }, iGroupSize_ { 0 }, iTaskRepeatCount_ { 1 },
-	bDryRun_(false), bHelp_{ false }, iRandPermAlgId_{ 0 }
+	bExcludeDups_{ false }, bHeap_{ false }, iGroupSize_ { 0 }, iTaskRepeatCount_ { 1 },
+	bDryRun_(false), bHelp_{ false }, iRandPermAlgId_{ 0 }, iThreadCount_{ 1 }
 {
 }
 
@@ -71,6 +73,9 @@ void StrPermGenCLIParser::parse() {
 			// Exclude duplicates.
 			if (_boolOption("x", bExcludeDups_))
 				continue;
+			// Heap's algorithm.
+			if (_boolOption("hp", bHeap_))
+				continue;
 			// Help.
 			if (_boolOption("h", bHelp_))
 				continue;
@@ -91,6 +96,11 @@ void StrPermGenCLIParser::parse() {
 					throw CLIParserException(string("Invalid random permutation algorithm id in CLI option ") + strOption + '.');
 				continue;
 			}
+			// The number of threads.
+			if (_uintOption("j", iThreadCount_))
+				continue;
+			if (_uintOption("-threads", iThreadCount_))
+				continue;
 			// The size of the consecutive groups to randomly pick permutations from.
 			if (_uintOption("g", iGroupSize_)) {
 				if (iGroupSize_ < 2)
@@ -108,6 +118,13 @@ void StrPermGenCLIParser::parse() {
 	if(getRandPermAlgId() > 0 && excludeDups())
 		throw CLIParserException("Incompatible options -rpa and -x.");
 
+	if (heap() && (lexicographic() || getRandPermAlgId() > 0 || excludeDups()))
+		throw CLIParserException("Option -hp is incompatible with options -l, -rpa and -x.");
+
+	// The parallel mode splits the sequence of the default generator.
+	if (getThreadCount() > 1 && (getGroupSize() || heap() || lexicographic() || getRandPermAlgId() > 0))
+		throw CLIParserException("Option -j is incompatible with options -g, -hp, -l and -rpa.");
+
 	if (getRandPermAlgId() > 1 && getPrintCount() == 0)
 		throw CLIParserException("Need to limit the output using the \"-c count\" option with this random permutation algorithm.");
 }
@@ -122,8 +139,10 @@ void StrPermGenCLIParser::printUsage() noexcept {
 	cout << " -er  regex - exclusion regex (-er and -ir are incompatible);" << '\n';
 	cout << " -g   size  - randomly pick one permutation per consecutive group;" << '\n';
 	cout << " -h         - print help info. Same as --help. Overrides all other options;" << '\n';
+	cout << " -hp        - generate permutations with Heap's algorithm (minimal change order);" << '\n';
 	cout << " -ir  regex - inclusion regex (-ir and -er are incompatible);" << '\n';
 	cout << " -is  str   - input string. Otherwise get it from the standard input stream;" << '\n';
+	cout << " -j   num   - the number of threads generating permutations. Same as --threads;" << '\n';
 	cout << " -l   order - (a)scending or (d)escending lexicographic order;" << '\n';
 	cout << " -n         - print permutation numbers;" << '\n';
 	cout << " -o   path  - output file path;" << '\n';
@@ -171,6 +190,9 @@ bool StrPermGenCLIParser::lexOrderAscending() const noexcept {
 bool StrPermGenCLIParser::excludeDups() const noexcept {
 	return bExcludeDups_;
 }
+bool StrPermGenCLIParser::heap() const noexcept {
+	return bHeap_;
+}
 size_t StrPermGenCLIParser::getGroupSize() const noexcept {
 	return iGroupSize_;
 }
@@ -186,3 +208,6 @@ bool StrPermGenCLIParser::help() const noexcept {
 size_t StrPermGenCLIParser::getRandPermAlgId() const noexcept {
 	return iRandPermAlgId_;
 }
+size_t StrPermGenCLIParser::getThreadCount() const noexcept {
+	return iThreadCount_;
+}
@@ -5,6 +5,8 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     16/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the Heap's algorithm option.
+    17/Oct/2026 - Added the thread count option.
 */
 
 #ifndef str_perm_gen_cli_hpp
@@ -30,11 +32,13 @@ public:
 	bool lexicographic() const noexcept;
 	bool lexOrderAscending() const noexcept;
 	bool excludeDups() const noexcept;
+	bool heap() const noexcept;
 	size_t getGroupSize() const noexcept;
 	size_t getTaskRepeatCount() const noexcept;
 	bool dryRun() const noexcept;
 	bool help() const noexcept;
 	size_t getRandPermAlgId() const noexcept;
+	size_t getThreadCount() const noexcept;
 
 private:
 	std::string strInput_;
@@ -55,6 +59,9 @@ private:
 
 	bool bExcludeDups_;
 
+	// Heap's algorithm.
+	bool bHeap_;
+
 	size_t iGroupSize_;
 
 	size_t iTaskRepeatCount_;
@@ -64,6 +71,8 @@ private:
 
 	// Random permutation algorithm Id.
 	size_t iRandPermAlgId_;
+
+	size_t iThreadCount_;
 };	// class StrPermGenCLIParser
 
 #endif //	str_perm_gen_cli_hpp
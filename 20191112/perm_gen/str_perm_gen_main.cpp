@@ -5,19 +5,45 @@ Copyright(c) 2019 David Krikheli
 
 Modification history:
     14/Nov/2019 - David Krikheli created the module.
+    17/Oct/2026 - Added the Heap's algorithm option.
+    17/Oct/2026 - Added the parallel mode.
+    17/Oct/2026 - Locate the start permutation instead of generating the preceding ones.
 */
 
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <chrono>
+#include <cstdint>
 #include "str_perm_gen.hpp"
+#include "str_perm_gen_par.hpp"
 #include "str_perm_gen_cli.hpp"
 #include "cli_misc.hpp"
 
 using namespace std;
 using namespace dk;
 
+// Locates the permutation the lexicographic generator would deliver after
+// skipping iSkipCount permutations. Leaves the permutation empty if there
+// are no more permutations. Returns false if the ranks don't fit into size_t.
+static bool skipLexicographic(const vector<char>& symbolPool, bool bAscending, size_t iSkipCount,
+	vector<char>& permutation) {
+	// The lexicographic sequence that starts at the sorted symbols is the
+	// sequence of the default generator with the duplicates excluded.
+	vector<char> sortedPool(symbolPool);
+	if (bAscending)
+		sort(sortedPool.begin(), sortedPool.end());
+	else
+		sort(sortedPool.rbegin(), sortedPool.rend());
+
+	size_t iRank;
+	if (!PermutationGeneratorBase<char>::rank(sortedPool, true, symbolPool, iRank) || iRank >= SIZE_MAX - iSkipCount)
+		return false;
+	if (!PermutationGeneratorBase<char>::unrank(sortedPool, true, iRank + iSkipCount, permutation))
+		permutation.clear();
+	return true;
+}
+
 void doExecUserTask(const StrPermGenCLIParser& parser, const string& inputString, ostream& outStream, size_t& iPermCount)
 {
 	// An input string is available. Let's process it.
@@ -29,21 +55,52 @@ void doExecUserTask(const StrPermGenCLIParser& parser, const string& inputString
 			sort(symbolPool.rbegin(), symbolPool.rend());
 	}
 
-	StringPermutationGenerator spg(
-		parser.getStartNumber(),
-		parser.getPrintCount(),
-		parser.printPermutationNumbers(),
-		outStream
-	);
+	auto makeGenerator = [&parser](ostream& outStream) {
+		auto spg = make_unique<StringPermutationGenerator>(
+			parser.getStartNumber(),
+			parser.getPrintCount(),
+			parser.printPermutationNumbers(),
+			outStream
+		);
+
+		spg->setSilent(parser.dryRun());
+		spg->setGroupSize(parser.getGroupSize());
+		if (parser.getRegexStr().size())
+			spg->assignRegex(parser.getRegexStr(), parser.isExclusionRegex());
+		return spg;
+	};
+
+	// The numbers of the permutations of longer strings don't fit into
+	// size_t, so they are generated on a single thread.
+	if (parser.getThreadCount() > 1 && symbolPool.size() <= maxParallelSymbolCount) {
+		iPermCount = generatePermutations_par(symbolPool, parser.excludeDups(), parser.getStartNumber(),
+			parser.getPrintCount(), parser.getThreadCount(), makeGenerator, outStream);
+		return;
+	}
 
-	spg.setSilent(parser.dryRun());
-	spg.setGroupSize(parser.getGroupSize());
-	if (parser.getRegexStr().size())
-		spg.assignRegex(parser.getRegexStr(), parser.isExclusionRegex());
+	auto spgPtr = makeGenerator(outStream);
+	StringPermutationGenerator& spg = *spgPtr;
 
+	// Start the lexicographic and the default generators at the permutation
+	// with the start number rather than generate and skip the preceding ones.
+	size_t iSkipCount = parser.getStartNumber() > 1 ? parser.getStartNumber() - 1 : 0;
 	try {
-		if (parser.lexicographic())
-			spg.generate_l(symbolPool, parser.lexOrderAscending());
+		vector<char> startPermutation;
+		if (parser.lexicographic()) {
+			if (iSkipCount && skipLexicographic(symbolPool, parser.lexOrderAscending(), iSkipCount, startPermutation)) {
+				spg.setPermutationNumber(iSkipCount);
+				if (startPermutation.size())
+					spg.generate_l(startPermutation, parser.lexOrderAscending());
+			}
+			else
+				spg.generate_l(symbolPool, parser.lexOrderAscending());
+		}
+		else if (parser.heap())
+			spg.generate_h(symbolPool);
+		else if (iSkipCount && parser.getRandPermAlgId() == 0) {
+			spg.setPermutationNumber(iSkipCount);
+			spg.generate_r(symbolPool, parser.excludeDups(), iSkipCount);
+		}
 		else
 			spg.generate(symbolPool, parser.excludeDups(), parser.getRandPermAlgId());
 	}
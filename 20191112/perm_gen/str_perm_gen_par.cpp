@@ -0,0 +1,256 @@
+/* str_perm_gen_par.cpp
+Implements the multithreaded string permutation generator of the String
+Permutation application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Start the ranges at the start permutation.
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "perm_gen_base.hpp"
+#include "str_perm_gen_par.hpp"
+
+using namespace std;
+using namespace dk;
+
+// The number of permutations a worker outputs before handing the output over
+// to the writer.
+static const size_t chunkSize{ 4096 };
+
+// The amount of output a worker buffers ahead of the range being written.
+static const size_t maxBufferedBytes{ 1 << 20 };
+
+// A range of permutations that share a prefix of their Lehmer codes.
+struct PermutationRange {
+	vector<size_t> prefix;
+	// The number of the permutations that precede the range.
+	size_t iFirstNumber;
+	size_t iSize;
+};
+
+// The output of a range handed over to the writer.
+struct OutputChunk {
+	string text;
+	size_t iPermCount;
+};
+
+struct RangeOutput {
+	deque<OutputChunk> chunks;
+	size_t iBufferedBytes{ 0 };
+	bool bDone{ false };
+};
+
+// Appends the range of the permutations that start with the prefix to the
+// list. Extends the prefix by another digit if the range is larger than
+// iMaxRangeSize. The ranges are listed in the order of generate(....).
+static void appendRanges(vector<size_t>& prefix, vector<char>& remainingSymbols, bool bExcludeDups,
+	size_t iMaxRangeSize, size_t& iFirstNumber, vector<PermutationRange>& ranges) {
+	size_t iSize = PermutationGeneratorBase<char>::countPermutations(remainingSymbols, bExcludeDups);
+	if (iSize <= iMaxRangeSize || remainingSymbols.size() < 2) {
+		ranges.push_back(PermutationRange{ prefix, iFirstNumber, iSize });
+		iFirstNumber += iSize;
+		return;
+	}
+
+	for (size_t inx = 0; inx < remainingSymbols.size(); inx++) {
+		// The default generator doesn't select a symbol twice at the same
+		// position if duplicates are excluded.
+		auto it = remainingSymbols.begin() + inx;
+		if (bExcludeDups && find(remainingSymbols.begin(), it, *it) != it)
+			continue;
+		char symbol = *it;
+		prefix.push_back(inx);
+		remainingSymbols.erase(it);
+		appendRanges(prefix, remainingSymbols, bExcludeDups, iMaxRangeSize, iFirstNumber, ranges);
+		remainingSymbols.insert(remainingSymbols.begin() + inx, symbol);
+		prefix.pop_back();
+	}
+}
+
+// Splits the permutations that follow the first iFirstNumber ones into at
+// least iMinRangeCount ranges, if there are that many.
+static vector<PermutationRange> splitPermutations(const vector<char>& symbolPool, bool bExcludeDups,
+	size_t iFirstNumber, size_t iMinRangeCount) {
+	vector<PermutationRange> ranges;
+	vector<size_t> code;
+	if (!PermutationGeneratorBase<char>::unrankCode(symbolPool, bExcludeDups, iFirstNumber, code))
+		return ranges;
+	size_t iMaxRangeSize = PermutationGeneratorBase<char>::countPermutations(symbolPool, bExcludeDups) - iFirstNumber;
+	iMaxRangeSize = max<size_t>(iMaxRangeSize / iMinRangeCount, 1);
+
+	// The remaining symbols on every level of the path of the first
+	// permutation down the recursion tree.
+	vector<vector<char>> remainingSymbols{ symbolPool };
+	for (size_t iDigit : code) {
+		remainingSymbols.push_back(remainingSymbols.back());
+		remainingSymbols.back().erase(remainingSymbols.back().begin() + iDigit);
+	}
+
+	// The first permutation is followed by its siblings on every level of
+	// the recursion tree, from the bottom level up.
+	ranges.push_back(PermutationRange{ code, iFirstNumber++, 1 });
+	vector<size_t> prefix;
+	for (size_t iLevel = code.size(); iLevel-- > 0;) {
+		prefix.assign(code.begin(), code.begin() + iLevel);
+		vector<char>& symbols = remainingSymbols[iLevel];
+		for (size_t inx = code[iLevel] + 1; inx < symbols.size(); inx++) {
+			auto it = symbols.begin() + inx;
+			if (bExcludeDups && find(symbols.begin(), it, *it) != it)
+				continue;
+			char symbol = *it;
+			prefix.push_back(inx);
+			symbols.erase(it);
+			appendRanges(prefix, symbols, bExcludeDups, iMaxRangeSize, iFirstNumber, ranges);
+			symbols.insert(symbols.begin() + inx, symbol);
+			prefix.pop_back();
+		}
+	}
+	return ranges;
+}
+
+size_t generatePermutations_par(const vector<char>& symbolPool, bool bExcludeDups,
+	size_t iStartNum, size_t iPrintCount, size_t nThreads, const StringGeneratorFactory& makeGenerator,
+	ostream& outStream) {
+	if (symbolPool.empty())
+		return 0;
+	// The numbers of the permutations are 1 based.
+	const vector<PermutationRange> ranges = splitPermutations(symbolPool, bExcludeDups,
+		iStartNum > 0 ? iStartNum - 1 : 0, 16 * nThreads);
+	vector<RangeOutput> outputs(ranges.size());
+
+	mutex outputMutex;
+	condition_variable outputCondition;
+	size_t inxNextRange{ 0 };
+	size_t inxWrittenRange{ 0 };
+	bool bStop{ false };
+	exception_ptr workerException;
+
+	// Hands the output of the range over to the writer. Unless the range is
+	// being written, waits while the writer is behind. Throws the stop signal
+	// if the writer doesn't need any more permutations.
+	auto deliver = [&](size_t inxRange, string&& text, size_t iPermCount, bool bDone) {
+		unique_lock<mutex> lock(outputMutex);
+		RangeOutput& output = outputs[inxRange];
+		if (!bDone)
+			outputCondition.wait(lock, [&]() {
+				return bStop || inxRange == inxWrittenRange || output.iBufferedBytes < maxBufferedBytes;
+			});
+		if (bStop && !bDone)
+			throw PermutationGeneratorStopSignal();
+		output.iBufferedBytes += text.size();
+		if (!output.chunks.empty() && text.empty() && output.chunks.back().text.empty())
+			// Nothing to print in the dry-run mode. Just count.
+			output.chunks.back().iPermCount += iPermCount;
+		else if (iPermCount > 0)
+			output.chunks.push_back(OutputChunk{ move(text), iPermCount });
+		output.bDone = bDone;
+		outputCondition.notify_all();
+	};
+
+	auto generateRanges = [&]() {
+		try {
+			while (true) {
+				size_t inxRange;
+				{
+					lock_guard<mutex> lock(outputMutex);
+					if (bStop || inxNextRange == ranges.size())
+						return;
+					inxRange = inxNextRange++;
+				}
+				const PermutationRange& range = ranges[inxRange];
+				ostringstream rangeStream;
+				auto spg = makeGenerator(rangeStream);
+				spg->setPermutationNumber(range.iFirstNumber);
+				size_t iDelivered{ 0 };
+				auto deliverChunk = [&](bool bDone) {
+					string text = rangeStream.str();
+					rangeStream.str("");
+					size_t iPermCount = spg->getPermutationCount();
+					deliver(inxRange, move(text), iPermCount - iDelivered, bDone);
+					iDelivered = iPermCount;
+				};
+				spg->setChunkCallback(chunkSize, [&deliverChunk]() { deliverChunk(false); });
+				try {
+					spg->generate_p(symbolPool, bExcludeDups, range.prefix);
+				}
+				catch (const PermutationGeneratorStopSignal&) {
+					// Either the generator has output iPrintCount permutations or
+					// the writer has stopped the workers.
+				}
+				deliverChunk(true);
+			}
+		}
+		catch (...) {
+			lock_guard<mutex> lock(outputMutex);
+			if (!workerException)
+				workerException = current_exception();
+			bStop = true;
+			outputCondition.notify_all();
+		}
+	};
+
+	vector<thread> workers;
+	for (size_t inx = 0; inx < nThreads; inx++)
+		workers.emplace_back(generateRanges);
+
+	// Write the output of the ranges in order. A single generator would stop
+	// after iPrintCount permutations, so the output is cut there.
+	size_t iPermCount{ 0 };
+	{
+		unique_lock<mutex> lock(outputMutex);
+		while (inxWrittenRange < ranges.size() && !bStop) {
+			RangeOutput& output = outputs[inxWrittenRange];
+			outputCondition.wait(lock, [&]() { return bStop || !output.chunks.empty() || output.bDone; });
+			if (bStop)
+				break;
+			if (output.chunks.empty()) {
+				inxWrittenRange++;
+				outputCondition.notify_all();
+				continue;
+			}
+
+			OutputChunk chunk = move(output.chunks.front());
+			output.chunks.pop_front();
+			output.iBufferedBytes -= chunk.text.size();
+			outputCondition.notify_all();
+			lock.unlock();
+
+			size_t iRemaining = iPrintCount ? iPrintCount - iPermCount : SIZE_MAX;
+			if (chunk.iPermCount <= iRemaining) {
+				outStream.write(chunk.text.data(), chunk.text.size());
+				iPermCount += chunk.iPermCount;
+			}
+			else {
+				// Cut the chunk after iRemaining lines.
+				size_t iEnd{ 0 };
+				for (size_t iLines = 0; iLines < iRemaining && iEnd < chunk.text.size(); iLines++)
+					iEnd = chunk.text.find('\n', iEnd) + 1;
+				outStream.write(chunk.text.data(), iEnd);
+				iPermCount += iRemaining;
+			}
+
+			lock.lock();
+			if (iPrintCount && iPermCount == iPrintCount)
+				break;
+		}
+		bStop = true;
+		outputCondition.notify_all();
+	}
+
+	for (auto& worker : workers)
+		worker.join();
+	if (workerException)
+		rethrow_exception(workerException);
+	return iPermCount;
+}
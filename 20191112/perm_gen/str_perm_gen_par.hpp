@@ -0,0 +1,55 @@
+/* str_perm_gen_par.hpp
+Declares the multithreaded string permutation generator of the String
+Permutation application.
+
+Copyright(c) 2019 David Krikheli
+
+Modification history:
+    17/Oct/2026 - Created the module.
+    17/Oct/2026 - Start the ranges at the start permutation.
+*/
+
+#ifndef str_perm_gen_par_hpp
+#define str_perm_gen_par_hpp
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "str_perm_gen.hpp"
+
+// Creates a string permutation generator configured by the application that
+// writes its output into the specified stream.
+typedef std::function<std::unique_ptr<StringPermutationGenerator>(std::ostream&)> StringGeneratorFactory;
+
+// Generates the permutations of the symbol pool with the default permutation
+// engine on nThreads threads and writes them into the output stream. The
+// output is the same as that of a single generator created by the factory
+// and started with generate(symbolPool, bExcludeDups, 0), i.e. the order of
+// the permutations, their numbers, the regex filter and the iStartNum and
+// iPrintCount limits are all preserved.
+//
+// The sequence of permutations is split into consecutive ranges of the
+// permutations that share the leading digits of their Lehmer codes (see
+// PermutationGeneratorBase::generate_p). The worker threads pick up the
+// ranges in order and generate each one with a generator of its own, which
+// starts numbering from the number of permutations in the preceding ranges.
+// The first range starts at the permutation number iStartNum located with
+// PermutationGeneratorBase::unrankCode(....), so the permutations that
+// precede it are not generated at all. The calling thread writes the output of the
+// ranges into the output stream in order. A worker that gets ahead of the
+// range being written buffers a limited amount of output and then waits.
+//
+// The permutation numbers must fit into size_t, so the symbol pool can't
+// hold more than 20 symbols.
+//
+// Returns the count of permutations intended for output.
+size_t generatePermutations_par(const std::vector<char>& symbolPool, bool bExcludeDups,
+	size_t iStartNum, size_t iPrintCount, size_t nThreads, const StringGeneratorFactory& makeGenerator,
+	std::ostream& outStream);
+
+// The largest number of symbols generatePermutations_par can permute.
+const size_t maxParallelSymbolCount{ 20 };
+
+#endif // str_perm_gen_par_hpp